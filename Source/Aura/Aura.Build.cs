@@ -23,6 +23,7 @@ public class Aura : ModuleRules
 			"AIModule",
 			"GameFeatures",
 			"Niagara",
+			"NetCore",
 		});
 
 		PrivateDependencyModuleNames.AddRange(new string[]
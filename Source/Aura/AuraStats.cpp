@@ -0,0 +1,39 @@
+#include "AuraStats.h"
+
+DEFINE_STAT(STAT_Aura_RuntimeEffectsCreated);
+DEFINE_STAT(STAT_Aura_DebuffsApplied);
+DEFINE_STAT(STAT_Aura_EffectContextPoolHits);
+DEFINE_STAT(STAT_Aura_EffectContextPoolMisses);
+DEFINE_STAT(STAT_Aura_AISignificanceUpdate);
+DEFINE_STAT(STAT_Aura_AIAgentsUpdated);
+DEFINE_STAT(STAT_Aura_AIServiceRuns);
+DEFINE_STAT(STAT_Aura_AICriticalAgents);
+DEFINE_STAT(STAT_Aura_AINearAgents);
+DEFINE_STAT(STAT_Aura_AIFarAgents);
+DEFINE_STAT(STAT_Aura_AIDormantAgents);
+DEFINE_STAT(STAT_Aura_ProjectileSpawn);
+DEFINE_STAT(STAT_Aura_ProjectilesSpawned);
+DEFINE_STAT(STAT_Aura_ProjectilesDestroyed);
+DEFINE_STAT(STAT_Aura_ProjectilesReused);
+DEFINE_STAT(STAT_Aura_ProjectilesPooled);
+DEFINE_STAT(STAT_Aura_ProjectileSim);
+DEFINE_STAT(STAT_Aura_ProjectilesSimulated);
+DEFINE_STAT(STAT_Aura_ProjectileSweeps);
+DEFINE_STAT(STAT_Aura_DamageNumberSpawn);
+DEFINE_STAT(STAT_Aura_DamageNumberDraw);
+DEFINE_STAT(STAT_Aura_DamageNumbersLive);
+DEFINE_STAT(STAT_Aura_DamageNumbersCoalesced);
+DEFINE_STAT(STAT_Aura_DamageNumbersEvicted);
+DEFINE_STAT(STAT_Aura_DamageTextComponentsLive);
+DEFINE_STAT(STAT_Aura_FadeUpdate);
+DEFINE_STAT(STAT_Aura_ActiveFades);
+DEFINE_STAT(STAT_Aura_OcclusionQuery);
+DEFINE_STAT(STAT_Aura_OcclusionSweeps);
+DEFINE_STAT(STAT_Aura_OcclusionFadeChanges);
+DEFINE_STAT(STAT_Aura_CursorTraceSync);
+DEFINE_STAT(STAT_Aura_CursorTracesAsync);
+DEFINE_STAT(STAT_Aura_CursorTraceReuses);
+DEFINE_STAT(STAT_Aura_ClickMovePathRequests);
+DEFINE_STAT(STAT_Aura_ClickMovePathCacheHits);
+DEFINE_STAT(STAT_Aura_ClickMovePathsSuperseded);
+DEFINE_STAT(STAT_Aura_ClickMovePathLatency);
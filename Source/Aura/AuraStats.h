@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("Aura"), STATGROUP_Aura, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Runtime GameplayEffects Created"), STAT_Aura_RuntimeEffectsCreated, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Debuffs Applied"), STAT_Aura_DebuffsApplied, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Effect Context Pool Hits"), STAT_Aura_EffectContextPoolHits, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Effect Context Pool Misses"), STAT_Aura_EffectContextPoolMisses, STATGROUP_Aura, AURA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Significance Update"), STAT_Aura_AISignificanceUpdate, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Agents Updated"), STAT_Aura_AIAgentsUpdated, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Service Runs"), STAT_Aura_AIServiceRuns, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Critical Agents"), STAT_Aura_AICriticalAgents, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Near Agents"), STAT_Aura_AINearAgents, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Far Agents"), STAT_Aura_AIFarAgents, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("AI Dormant Agents"), STAT_Aura_AIDormantAgents, STATGROUP_Aura, AURA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Spawn"), STAT_Aura_ProjectileSpawn, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Projectile Actors Spawned"), STAT_Aura_ProjectilesSpawned, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Projectile Actors Destroyed"), STAT_Aura_ProjectilesDestroyed, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Projectiles Reused"), STAT_Aura_ProjectilesReused, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Projectiles Pooled"), STAT_Aura_ProjectilesPooled, STATGROUP_Aura, AURA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Simulation"), STAT_Aura_ProjectileSim, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Projectiles Simulated"), STAT_Aura_ProjectilesSimulated, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Projectile Sweeps"), STAT_Aura_ProjectileSweeps, STATGROUP_Aura, AURA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Number Spawn"), STAT_Aura_DamageNumberSpawn, STATGROUP_Aura, AURA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Number Draw"), STAT_Aura_DamageNumberDraw, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Damage Numbers Live"), STAT_Aura_DamageNumbersLive, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Damage Numbers Coalesced"), STAT_Aura_DamageNumbersCoalesced, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Damage Numbers Evicted"), STAT_Aura_DamageNumbersEvicted, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Damage Text Components Live"), STAT_Aura_DamageTextComponentsLive, STATGROUP_Aura, AURA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Fade Update"), STAT_Aura_FadeUpdate, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Fades"), STAT_Aura_ActiveFades, STATGROUP_Aura, AURA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera Occlusion Query"), STAT_Aura_OcclusionQuery, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Camera Occlusion Sweeps"), STAT_Aura_OcclusionSweeps, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Camera Occlusion Fade Changes"), STAT_Aura_OcclusionFadeChanges, STATGROUP_Aura, AURA_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Cursor Trace Sync"), STAT_Aura_CursorTraceSync, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cursor Traces Async"), STAT_Aura_CursorTracesAsync, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cursor Trace Reuses"), STAT_Aura_CursorTraceReuses, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Click Move Path Requests"), STAT_Aura_ClickMovePathRequests, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Click Move Path Cache Hits"), STAT_Aura_ClickMovePathCacheHits, STATGROUP_Aura, AURA_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Click Move Paths Superseded"), STAT_Aura_ClickMovePathsSuperseded, STATGROUP_Aura, AURA_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Click Move Path Latency (ms)"), STAT_Aura_ClickMovePathLatency, STATGROUP_Aura, AURA_API);
@@ -3,13 +3,13 @@
 
 #include "AI/AuraAIController.h"
 
-#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "AI/AuraBehaviorTreeComponent.h"
 #include "BehaviorTree/BlackboardComponent.h"
 
 AAuraAIController::AAuraAIController()
 {
 	Blackboard = CreateDefaultSubobject<UBlackboardComponent>(TEXT("BlackboardComponent"));
 	check(Blackboard!= nullptr);
-	BehaviorTreeComponent = CreateDefaultSubobject<UBehaviorTreeComponent>(TEXT("BehaviorTreeComponent"));
+	BehaviorTreeComponent = CreateDefaultSubobject<UAuraBehaviorTreeComponent>(TEXT("BehaviorTreeComponent"));
 	check(BehaviorTreeComponent != nullptr);
 }
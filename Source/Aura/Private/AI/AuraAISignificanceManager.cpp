@@ -0,0 +1,215 @@
+// Copyright Axchemy Games
+
+
+#include "AI/AuraAISignificanceManager.h"
+
+#include "AIController.h"
+#include "Aura/AuraStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Game/AuraCombatantRegistry.h"
+#include "Interaction/CombatInterface.h"
+
+static TAutoConsoleVariable<bool> CVarAuraAISignificanceEnabled(
+	TEXT("Aura.AI.Significance.Enabled"),
+	true,
+	TEXT("Throttle AI behavior trees and services by significance. When off every agent runs at full rate."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAuraAISignificanceNearDistance(
+	TEXT("Aura.AI.Significance.NearDistance"),
+	1500.f,
+	TEXT("Agents within this distance of a player are Critical when on screen and Near otherwise."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAuraAISignificanceFarDistance(
+	TEXT("Aura.AI.Significance.FarDistance"),
+	4000.f,
+	TEXT("Agents within this distance of a player are Near when on screen and Far otherwise. Anything further is Dormant."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<FString> CVarAuraAISignificanceTickIntervals(
+	TEXT("Aura.AI.Significance.TickIntervals"),
+	TEXT("0,0.1,0.25,1"),
+	TEXT("Minimum seconds between behavior tree ticks for Critical,Near,Far,Dormant agents."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<FString> CVarAuraAISignificanceServiceIntervals(
+	TEXT("Aura.AI.Significance.ServiceIntervals"),
+	TEXT("0,1,2,4"),
+	TEXT("Seconds between budgeted service runs (e.g. FindNearestPlayer) for Critical,Near,Far,Dormant agents. 0 keeps the node's own interval."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAuraAISignificanceBudgetMs(
+	TEXT("Aura.AI.Significance.BudgetMs"),
+	0.25f,
+	TEXT("Milliseconds per frame spent re-evaluating agents. Whatever doesn't fit carries over to the next frame."),
+	ECVF_Default);
+
+namespace AuraAISignificance
+{
+	// Wall clock is only checked every few agents, one evaluation is far cheaper than the clock read
+	static constexpr int32 AgentsPerTimeCheck = 4;
+
+	static void ParseIntervals(const FString& List, float (&OutIntervals)[static_cast<int32>(EAuraAISignificance::MAX)])
+	{
+		TArray<FString> Values;
+		List.ParseIntoArray(Values, TEXT(","));
+		for(int32 i = 0; i < Values.Num() && i < static_cast<int32>(EAuraAISignificance::MAX); i++)
+		{
+			OutIntervals[i] = FMath::Max(FCString::Atof(*Values[i].TrimStartAndEnd()), 0.f);
+		}
+	}
+}
+
+UAuraAISignificanceManager* UAuraAISignificanceManager::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UAuraAISignificanceManager>() : nullptr;
+}
+
+void UAuraAISignificanceManager::RegisterAgent(UAuraBehaviorTreeComponent* Agent)
+{
+	if(Agent == nullptr || Agents.ContainsByPredicate([Agent](const FAgent& Entry) { return Entry.Component == Agent; })) return;
+
+	// New agents start at full rate until their first evaluation
+	RefreshSettings();
+	const FBucketSettings& Settings = Buckets[static_cast<int32>(EAuraAISignificance::Critical)];
+	Agent->SetSignificance(EAuraAISignificance::Critical, Settings.TickInterval, Settings.ServiceInterval);
+	Agents.Add({ Agent, EAuraAISignificance::Critical });
+	BucketCounts[static_cast<int32>(EAuraAISignificance::Critical)]++;
+}
+
+void UAuraAISignificanceManager::UnregisterAgent(UAuraBehaviorTreeComponent* Agent)
+{
+	const int32 Index = Agents.IndexOfByPredicate([Agent](const FAgent& Entry) { return Entry.Component == Agent; });
+	if(Index != INDEX_NONE)
+	{
+		RemoveAgentAt(Index);
+	}
+}
+
+void UAuraAISignificanceManager::RemoveAgentAt(int32 Index)
+{
+	BucketCounts[static_cast<int32>(Agents[Index].Significance)]--;
+	Agents.RemoveAtSwap(Index, EAllowShrinking::No);
+	if(NextAgent > Index)
+	{
+		NextAgent--;
+	}
+}
+
+void UAuraAISignificanceManager::RefreshSettings()
+{
+	const bool bEnabled = CVarAuraAISignificanceEnabled.GetValueOnGameThread();
+	const FString TickIntervals = bEnabled ? CVarAuraAISignificanceTickIntervals.GetValueOnGameThread() : FString();
+	const FString ServiceIntervals = bEnabled ? CVarAuraAISignificanceServiceIntervals.GetValueOnGameThread() : FString();
+	if(TickIntervals == CachedTickIntervals && ServiceIntervals == CachedServiceIntervals) return;
+
+	CachedTickIntervals = TickIntervals;
+	CachedServiceIntervals = ServiceIntervals;
+
+	float ParsedTickIntervals[static_cast<int32>(EAuraAISignificance::MAX)] = {};
+	float ParsedServiceIntervals[static_cast<int32>(EAuraAISignificance::MAX)] = {};
+	AuraAISignificance::ParseIntervals(TickIntervals, ParsedTickIntervals);
+	AuraAISignificance::ParseIntervals(ServiceIntervals, ParsedServiceIntervals);
+	for(int32 i = 0; i < static_cast<int32>(EAuraAISignificance::MAX); i++)
+	{
+		Buckets[i].TickInterval = ParsedTickIntervals[i];
+		Buckets[i].ServiceInterval = ParsedServiceIntervals[i];
+	}
+
+	// New settings reach every agent right away, outside the per-frame budget
+	for(const FAgent& Agent : Agents)
+	{
+		if(UAuraBehaviorTreeComponent* Component = Agent.Component.Get())
+		{
+			const FBucketSettings& Settings = Buckets[static_cast<int32>(Agent.Significance)];
+			Component->SetSignificance(Agent.Significance, Settings.TickInterval, Settings.ServiceInterval);
+		}
+	}
+}
+
+EAuraAISignificance UAuraAISignificanceManager::Evaluate(const APawn* Pawn) const
+{
+	if(!CVarAuraAISignificanceEnabled.GetValueOnGameThread()) return EAuraAISignificance::Critical;
+
+	const float NearDistance = CVarAuraAISignificanceNearDistance.GetValueOnGameThread();
+	const float FarDistance = FMath::Max(CVarAuraAISignificanceFarDistance.GetValueOnGameThread(), NearDistance);
+
+	const UAuraCombatantRegistry* CombatantRegistry = UAuraCombatantRegistry::Get(this);
+	if(CombatantRegistry == nullptr) return EAuraAISignificance::Critical;
+
+	TArray<AActor*, TInlineAllocator<1>> NearestPlayer;
+	CombatantRegistry->GetKNearest(Pawn->GetActorLocation(), 1, FarDistance, NearestPlayer, {}, MakeFactionMask(EAuraFaction::Player));
+	if(NearestPlayer.Num() == 0) return EAuraAISignificance::Dormant;
+
+	// A dedicated server renders nothing, distance alone decides there
+	const bool bOnScreen = GetWorld()->GetNetMode() == NM_DedicatedServer || Pawn->WasRecentlyRendered(0.25f);
+	const bool bNear = FVector::DistSquared(Pawn->GetActorLocation(), NearestPlayer[0]->GetActorLocation()) <= FMath::Square(NearDistance);
+	if(bNear)
+	{
+		return bOnScreen ? EAuraAISignificance::Critical : EAuraAISignificance::Near;
+	}
+	return bOnScreen ? EAuraAISignificance::Near : EAuraAISignificance::Far;
+}
+
+void UAuraAISignificanceManager::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Aura_AISignificanceUpdate);
+	Super::Tick(DeltaTime);
+
+	RefreshSettings();
+
+	const double Deadline = FPlatformTime::Seconds() + CVarAuraAISignificanceBudgetMs.GetValueOnGameThread() / 1000.0;
+	int32 NumUpdated = 0;
+	int32 NumToVisit = Agents.Num();
+	while(NumToVisit-- > 0 && Agents.Num() > 0)
+	{
+		if(NextAgent >= Agents.Num())
+		{
+			NextAgent = 0;
+		}
+
+		FAgent& Agent = Agents[NextAgent];
+		UAuraBehaviorTreeComponent* Component = Agent.Component.Get();
+		const AAIController* Controller = Component ? Component->GetAIOwner() : nullptr;
+		const APawn* Pawn = Controller ? Controller->GetPawn() : nullptr;
+		if(Component == nullptr)
+		{
+			RemoveAgentAt(NextAgent);
+			continue;
+		}
+		NextAgent++;
+		if(Pawn == nullptr) continue;
+
+		const EAuraAISignificance Significance = Evaluate(Pawn);
+		if(Significance != Agent.Significance)
+		{
+			BucketCounts[static_cast<int32>(Agent.Significance)]--;
+			BucketCounts[static_cast<int32>(Significance)]++;
+			Agent.Significance = Significance;
+			const FBucketSettings& Settings = Buckets[static_cast<int32>(Significance)];
+			Component->SetSignificance(Significance, Settings.TickInterval, Settings.ServiceInterval);
+		}
+
+		NumUpdated++;
+		if(NumUpdated % AuraAISignificance::AgentsPerTimeCheck == 0 && FPlatformTime::Seconds() >= Deadline) break;
+	}
+
+	INC_DWORD_STAT_BY(STAT_Aura_AIAgentsUpdated, NumUpdated);
+	SET_DWORD_STAT(STAT_Aura_AICriticalAgents, BucketCounts[static_cast<int32>(EAuraAISignificance::Critical)]);
+	SET_DWORD_STAT(STAT_Aura_AINearAgents, BucketCounts[static_cast<int32>(EAuraAISignificance::Near)]);
+	SET_DWORD_STAT(STAT_Aura_AIFarAgents, BucketCounts[static_cast<int32>(EAuraAISignificance::Far)]);
+	SET_DWORD_STAT(STAT_Aura_AIDormantAgents, BucketCounts[static_cast<int32>(EAuraAISignificance::Dormant)]);
+}
+
+TStatId UAuraAISignificanceManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraAISignificanceManager, STATGROUP_Tickables);
+}
+
+bool UAuraAISignificanceManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,43 @@
+// Copyright Axchemy Games
+
+
+#include "AI/AuraBehaviorTreeComponent.h"
+
+#include "AI/AuraAISignificanceManager.h"
+
+void UAuraBehaviorTreeComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	SkippedDeltaTime += DeltaTime;
+	if(SkippedDeltaTime < MinTickInterval) return;
+
+	const float TickDeltaTime = SkippedDeltaTime;
+	SkippedDeltaTime = 0.f;
+	Super::TickComponent(TickDeltaTime, TickType, ThisTickFunction);
+}
+
+void UAuraBehaviorTreeComponent::SetSignificance(EAuraAISignificance InSignificance, float InMinTickInterval, float InServiceInterval)
+{
+	Significance = InSignificance;
+	MinTickInterval = InMinTickInterval;
+	ServiceInterval = InServiceInterval;
+}
+
+void UAuraBehaviorTreeComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if(UAuraAISignificanceManager* SignificanceManager = UAuraAISignificanceManager::Get(this))
+	{
+		SignificanceManager->RegisterAgent(this);
+	}
+}
+
+void UAuraBehaviorTreeComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if(UAuraAISignificanceManager* SignificanceManager = UAuraAISignificanceManager::Get(this))
+	{
+		SignificanceManager->UnregisterAgent(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
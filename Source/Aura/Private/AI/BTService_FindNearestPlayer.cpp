@@ -4,35 +4,32 @@
 #include "AI/BTService_FindNearestPlayer.h"
 
 #include "AIController.h"
+#include "AI/AuraBehaviorTreeComponent.h"
+#include "Aura/AuraStats.h"
 #include "BehaviorTree/BTFunctionLibrary.h"
-#include "Kismet/GameplayStatics.h"
+#include "Game/AuraCombatantRegistry.h"
 
 void UBTService_FindNearestPlayer::TickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds)
 {
 	Super::TickNode(OwnerComp, NodeMemory, DeltaSeconds);
 	
 	const APawn* OwningPawn = AIOwner->GetPawn();
-	
-	const FName TargetTag = OwningPawn->ActorHasTag(FName("Player")) ? FName("Enemy") : FName("Player");
-
-	TArray<AActor*> ActorsWithTag;
-	UGameplayStatics::GetAllActorsWithTag(GetWorld(), TargetTag, ActorsWithTag);
+	const UAuraCombatantRegistry* CombatantRegistry = UAuraCombatantRegistry::Get(OwningPawn);
+	if(!IsValid(OwningPawn) || CombatantRegistry == nullptr) return;
 
 	float ClosesDistance = TNumericLimits<float>::Max();
-	AActor* ClosestActor = nullptr;
-	for(AActor* Actor: ActorsWithTag)
+	AActor* ClosestActor = CombatantRegistry->FindNearestHostile(OwningPawn, ClosesDistance);
+
+	UBTFunctionLibrary::SetBlackboardValueAsObject(this, TargetToFollowSelector, ClosestActor);
+	UBTFunctionLibrary::SetBlackboardValueAsFloat(this, DistanceToTargetSelector, ClosesDistance);
+	INC_DWORD_STAT(STAT_Aura_AIServiceRuns);
+
+	// Less significant agents look for targets less often, see UAuraAISignificanceManager
+	if(const UAuraBehaviorTreeComponent* AuraOwnerComp = Cast<UAuraBehaviorTreeComponent>(&OwnerComp))
 	{
-		if (IsValid(Actor) && IsValid(OwningPawn))
+		if(AuraOwnerComp->GetServiceInterval() > 0.f)
 		{
-			const float Distance = OwningPawn->GetDistanceTo(Actor);
-			if(Distance < ClosesDistance)
-			{
-				ClosesDistance = Distance;
-				ClosestActor = Actor;
-			}
+			SetNextTickTime(NodeMemory, AuraOwnerComp->GetServiceInterval());
 		}
 	}
-
-	UBTFunctionLibrary::SetBlackboardValueAsObject(this, TargetToFollowSelector, ClosestActor);
-	UBTFunctionLibrary::SetBlackboardValueAsFloat(this, DistanceToTargetSelector, ClosesDistance);
 }
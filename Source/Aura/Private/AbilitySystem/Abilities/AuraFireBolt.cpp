@@ -6,6 +6,7 @@
 #include "AuraGameplayTags.h"
 #include "AbilitySystem/AuraAbilitySystemLibrary.h"
 #include "Actor/AuraProjectile.h"
+#include "Game/AuraProjectilePool.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 
 
@@ -95,13 +96,14 @@ void UAuraFireBolt::SpawnProjectiles(const FVector& ProjectileTargetLocation, co
 		SpawnTransform.SetLocation(SocketLocation);
 		SpawnTransform.SetRotation(Rot.Quaternion());
 	  
-		AAuraProjectile* Projectile = GetWorld()->SpawnActorDeferred<AAuraProjectile>(
+		AAuraProjectile* Projectile = UAuraProjectilePool::SpawnProjectileDeferred(
+			this,
 			ProjectileClass,
 			SpawnTransform,
 			GetOwningActorFromActorInfo(),
-			Cast<APawn>(GetOwningActorFromActorInfo()),
-			ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+			Cast<APawn>(GetOwningActorFromActorInfo())
 		);
+		if(Projectile == nullptr) continue;
 
 		Projectile->DamageEffectParams = MakeDamageEffectParamsFromClassDefaults();
 		
@@ -111,13 +113,12 @@ void UAuraFireBolt::SpawnProjectiles(const FVector& ProjectileTargetLocation, co
 		}
 		else
 		{
-			Projectile->HomingTargetSceneComponent = NewObject<USceneComponent>(USceneComponent::StaticClass());
 			Projectile->HomingTargetSceneComponent->SetWorldLocation(ProjectileTargetLocation);
 			Projectile->ProjectileMovement->HomingTargetComponent = Projectile->HomingTargetSceneComponent;
 		}
 		Projectile->ProjectileMovement->HomingAccelerationMagnitude = FMath::RandRange(HomingAccelerationMin, HomingAccelerationMax);
 		Projectile->ProjectileMovement->bIsHomingProjectile = bLaunchHomeProjectile;
 		
-		Projectile->FinishSpawning(SpawnTransform);
+		UAuraProjectilePool::FinishSpawningProjectile(Projectile, SpawnTransform);
 	}
 }
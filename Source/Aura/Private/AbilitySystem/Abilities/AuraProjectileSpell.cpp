@@ -7,6 +7,7 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystem/AuraAbilitySystemLibrary.h"
 #include "Actor/AuraProjectile.h"
+#include "Game/AuraProjectilePool.h"
 #include "Interaction/CombatInterface.h"
 
 void UAuraProjectileSpell::ActivateAbility(const FGameplayAbilitySpecHandle Handle,
@@ -18,6 +19,19 @@ void UAuraProjectileSpell::ActivateAbility(const FGameplayAbilitySpecHandle Hand
 	
 }
 
+void UAuraProjectileSpell::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	Super::OnGiveAbility(ActorInfo, Spec);
+
+	if(ProjectileClass == nullptr || ActorInfo == nullptr || !ActorInfo->IsNetAuthority()) return;
+
+	// Fill the pool now so the first casts don't pay for actor spawns
+	if(UAuraProjectilePool* Pool = UAuraProjectilePool::Get(ActorInfo->OwnerActor.Get()))
+	{
+		Pool->Prewarm(ProjectileClass);
+	}
+}
+
 void UAuraProjectileSpell::SpawnProjectile(const FVector& ProjectileTargetLocation, const FTaggedMontage& AttackMontage, bool bOverridePitch , float PitchOverride)
 {
 	if(ProjectileClass == nullptr) return;
@@ -37,15 +51,16 @@ void UAuraProjectileSpell::SpawnProjectile(const FVector& ProjectileTargetLocati
 	SpawnTransform.SetLocation(SocketLocation);
 	SpawnTransform.SetRotation(Rotation.Quaternion());
 	  
-	AAuraProjectile* Projectile = GetWorld()->SpawnActorDeferred<AAuraProjectile>(
+	AAuraProjectile* Projectile = UAuraProjectilePool::SpawnProjectileDeferred(
+		this,
 		ProjectileClass,
 		SpawnTransform,
 		GetOwningActorFromActorInfo(),
-		Cast<APawn>(GetOwningActorFromActorInfo()),
-		ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+		Cast<APawn>(GetOwningActorFromActorInfo())
 	);
+	if(Projectile == nullptr) return;
 
 	Projectile->DamageEffectParams = MakeDamageEffectParamsFromClassDefaults();
 		
-	Projectile->FinishSpawning(SpawnTransform);
+	UAuraProjectilePool::FinishSpawningProjectile(Projectile, SpawnTransform);
 }
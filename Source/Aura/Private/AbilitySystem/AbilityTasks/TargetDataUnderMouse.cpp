@@ -5,6 +5,7 @@
 
 #include "AbilitySystemComponent.h"
 #include "Aura/Aura.h"
+#include "Components/AuraCursorHitComponent.h"
 
 UTargetDataUnderMouse* UTargetDataUnderMouse::CreateTargetDataUnderMouse(UGameplayAbility* OwningAbility)
 {
@@ -38,7 +39,15 @@ void UTargetDataUnderMouse::SendMouseCursorData()
 	
 	APlayerController* PC = Ability->GetCurrentActorInfo()->PlayerController.Get();
 	FHitResult CursorHit;
-	PC->GetHitResultUnderCursor(ECC_Target, false, CursorHit);
+	if(UAuraCursorHitComponent* CursorHits = PC->FindComponentByClass<UAuraCursorHitComponent>())
+	{
+		// Reuses the cursor hit already traced this frame when nothing under the cursor changed
+		CursorHit = CursorHits->GetHitResult(ECC_Target, true);
+	}
+	else
+	{
+		PC->GetHitResultUnderCursor(ECC_Target, false, CursorHit);
+	}
 
 	FGameplayAbilityTargetDataHandle DataHandle;
 	FGameplayAbilityTargetData_SingleTargetHit* Data = new FGameplayAbilityTargetData_SingleTargetHit();
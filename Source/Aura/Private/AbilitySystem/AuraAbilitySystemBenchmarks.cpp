@@ -0,0 +1,740 @@
+// Copyright Axchemy Games
+
+
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "AuraAbilityTypes.h"
+#include "AuraGameplayTags.h"
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "AbilitySystem/AuraAttributeSet.h"
+#include "AbilitySystem/Abilities/AuraDamageGameplayAbility.h"
+#include "AbilitySystem/Data/AbilityInfo.h"
+#include "Aura/AuraLogChannels.h"
+#include "Character/AuraEnemy.h"
+#include "Game/AuraCombatantRegistry.h"
+#include "HAL/FileManager.h"
+#include "Interaction/CombatInterface.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/CoreNet.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace AuraAbilitySystemBenchmarks
+{
+	static bool MakeLocalPlayerDamageParams(UWorld* World, FDamageEffectParams& OutParams)
+	{
+		const APlayerController* PC = World->GetFirstPlayerController();
+		UAbilitySystemComponent* SourceASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(PC ? PC->GetPawn() : nullptr);
+		if(SourceASC == nullptr) return false;
+
+		for(const FGameplayAbilitySpec& AbilitySpec : SourceASC->GetActivatableAbilities())
+		{
+			if(const UAuraDamageGameplayAbility* DamageAbility = Cast<UAuraDamageGameplayAbility>(AbilitySpec.GetPrimaryInstance()))
+			{
+				OutParams = DamageAbility->MakeDamageEffectParamsFromClassDefaults();
+				if(OutParams.DamageType.Num() > 0) return true;
+			}
+		}
+		return false;
+	}
+
+	static void GatherLiveEnemies(UWorld* World, int32 MaxTargets, TArray<UAbilitySystemComponent*>& OutTargets)
+	{
+		for(TActorIterator<AAuraEnemy> It(World); It && OutTargets.Num() < MaxTargets; ++It)
+		{
+			if(ICombatInterface::Execute_IsDead(*It)) continue;
+			if(UAbilitySystemComponent* ASC = It->GetAbilitySystemComponent())
+			{
+				OutTargets.Add(ASC);
+			}
+		}
+	}
+
+	static AAuraCharacterBase* SpawnCombatant(UWorld* World, UClass* CombatantClass, const FVector& Location, int32 FactionMask = 0)
+	{
+		AAuraCharacterBase* Combatant = World->SpawnActorDeferred<AAuraCharacterBase>(CombatantClass, FTransform(Location), nullptr, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		if(Combatant == nullptr) return nullptr;
+
+		// No AI, the benchmarks only measure the systems they drive
+		Combatant->AutoPossessAI = EAutoPossessAI::Disabled;
+		if(FactionMask != 0)
+		{
+			// Tags too, the legacy tag scan in the combatant benchmark still reads them
+			Combatant->SetFactionMask(FactionMask);
+			Combatant->Tags.Remove(FName("Player"));
+			Combatant->Tags.Remove(FName("Enemy"));
+			Combatant->Tags.Add((FactionMask & MakeFactionMask(EAuraFaction::Player)) != 0 ? FName("Player") : FName("Enemy"));
+		}
+		Combatant->FinishSpawning(FTransform(Location));
+		return Combatant;
+	}
+
+	static void GrantPassive(UAbilitySystemComponent* ASC, const UAbilityInfo* AbilityInfo, const FGameplayTag& PassiveTag)
+	{
+		if(ASC == nullptr || AbilityInfo == nullptr) return;
+
+		const FAuraAbilityInfo& Info = AbilityInfo->GetAbilityInfoForTag(PassiveTag);
+		if(Info.Ability)
+		{
+			ASC->GiveAbility(FGameplayAbilitySpec(Info.Ability, 1));
+		}
+		ASC->AddLooseGameplayTag(PassiveTag);
+	}
+
+	static void RefillHealth(UAbilitySystemComponent* ASC)
+	{
+		ASC->SetNumericAttributeBase(UAuraAttributeSet::GetHealthAttribute(), ASC->GetNumericAttribute(UAuraAttributeSet::GetMaxHealthAttribute()));
+		ASC->SetNumericAttributeBase(UAuraAttributeSet::GetManaAttribute(), 0.f);
+	}
+
+	static double Percentile(const TArray<double>& SortedValues, double Fraction)
+	{
+		if(SortedValues.Num() == 0) return 0.0;
+		const int32 Index = FMath::Clamp(FMath::FloorToInt32(Fraction * SortedValues.Num()), 0, SortedValues.Num() - 1);
+		return SortedValues[Index];
+	}
+
+	// Returns false if the benchmark couldn't run in World
+	static bool RunCombatBenchmark(const TArray<FString>& Args, UWorld* World)
+	{
+		if(World == nullptr || World->GetNetMode() == NM_Client)
+		{
+			UE_LOG(LogAura, Warning, TEXT("%hs: needs an authoritative game world"), __FUNCTION__);
+			return false;
+		}
+
+		const FString Params = FString::Join(Args, TEXT(" "));
+		int32 NumEnemies = 200;
+		int32 NumAttackers = 16;
+		int32 NumHits = 20000;
+		float Damage = 1.f;
+		float DebuffChance = 20.f;
+		bool bBatch = false;
+		bool bKeep = false;
+		FString EnemyClassPath;
+		FString AttackerClassPath;
+		FString DamageEffectPath = TEXT("/Game/Blueprints/AbilitySystem/CommonEffects/GE_Damage.GE_Damage_C");
+		FString CsvName = TEXT("AuraCombatBench.csv");
+		FParse::Value(*Params, TEXT("Enemies="), NumEnemies);
+		FParse::Value(*Params, TEXT("Attackers="), NumAttackers);
+		FParse::Value(*Params, TEXT("Hits="), NumHits);
+		FParse::Value(*Params, TEXT("Damage="), Damage);
+		FParse::Value(*Params, TEXT("DebuffChance="), DebuffChance);
+		FParse::Bool(*Params, TEXT("Batch="), bBatch);
+		FParse::Bool(*Params, TEXT("Keep="), bKeep);
+		FParse::Value(*Params, TEXT("EnemyClass="), EnemyClassPath);
+		FParse::Value(*Params, TEXT("AttackerClass="), AttackerClassPath);
+		FParse::Value(*Params, TEXT("DamageEffect="), DamageEffectPath);
+		FParse::Value(*Params, TEXT("Csv="), CsvName);
+		NumEnemies = FMath::Max(1, NumEnemies);
+		NumAttackers = FMath::Max(1, NumAttackers);
+		NumHits = FMath::Max(1, NumHits);
+
+		UClass* EnemyClass = EnemyClassPath.IsEmpty() ? AAuraEnemy::StaticClass() : LoadClass<AAuraCharacterBase>(nullptr, *EnemyClassPath);
+		UClass* AttackerClass = AttackerClassPath.IsEmpty() ? EnemyClass : LoadClass<AAuraCharacterBase>(nullptr, *AttackerClassPath);
+		UClass* DamageEffectClass = LoadClass<UGameplayEffect>(nullptr, *DamageEffectPath);
+		if(EnemyClass == nullptr || AttackerClass == nullptr || DamageEffectClass == nullptr)
+		{
+			UE_LOG(LogAura, Warning, TEXT("%hs: could not load the combatant or damage effect classes"), __FUNCTION__);
+			return false;
+		}
+
+		// Attackers stand in a ring around the origin, targets in a grid inside it
+		const APlayerController* PC = World->GetFirstPlayerController();
+		const FVector Origin = PC && PC->GetPawn() ? PC->GetPawn()->GetActorLocation() : FVector::ZeroVector;
+		const int32 GridSide = FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(NumEnemies)));
+
+		TArray<AAuraCharacterBase*> Spawned;
+		TArray<UAbilitySystemComponent*> Targets;
+		TArray<UAbilitySystemComponent*> Attackers;
+		for(int32 i = 0; i < NumEnemies; i++)
+		{
+			const FVector Location = Origin + FVector((i % GridSide - GridSide / 2) * 150.f, (i / GridSide - GridSide / 2) * 150.f, 0.f);
+			if(AAuraCharacterBase* Enemy = SpawnCombatant(World, EnemyClass, Location))
+			{
+				Spawned.Add(Enemy);
+				Targets.Add(Enemy->GetAbilitySystemComponent());
+			}
+		}
+		const float RingRadius = GridSide * 150.f + 500.f;
+		for(int32 i = 0; i < NumAttackers; i++)
+		{
+			const FVector Location = Origin + FVector(RingRadius, 0.f, 0.f).RotateAngleAxis(360.f * i / NumAttackers, FVector::UpVector);
+			if(AAuraCharacterBase* Attacker = SpawnCombatant(World, AttackerClass, Location))
+			{
+				Spawned.Add(Attacker);
+				Attackers.Add(Attacker->GetAbilitySystemComponent());
+			}
+		}
+		Targets.RemoveAll([](const UAbilitySystemComponent* ASC) { return ASC == nullptr; });
+		Attackers.RemoveAll([](const UAbilitySystemComponent* ASC) { return ASC == nullptr; });
+		if(Targets.Num() == 0 || Attackers.Num() == 0)
+		{
+			UE_LOG(LogAura, Warning, TEXT("%hs: failed to spawn combatants"), __FUNCTION__);
+			return false;
+		}
+
+		// Siphons on the attackers and Halo of Protection on the targets, so every branch of the pipeline runs
+		const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+		const UAbilityInfo* AbilityInfo = UAuraAbilitySystemLibrary::GetAbilityInfo(World);
+		for(UAbilitySystemComponent* Attacker : Attackers)
+		{
+			GrantPassive(Attacker, AbilityInfo, GameplayTags.Abilities_Passive_LifeSiphon);
+			GrantPassive(Attacker, AbilityInfo, GameplayTags.Abilities_Passive_ManaSiphon);
+		}
+		for(UAbilitySystemComponent* Target : Targets)
+		{
+			GrantPassive(Target, AbilityInfo, GameplayTags.Abilities_Passive_HaloOfProtection);
+		}
+
+		// Every damage type on every hit
+		TArray<FDamageEffectParams> AttackerParams;
+		for(UAbilitySystemComponent* Attacker : Attackers)
+		{
+			FDamageEffectParams& DamageParams = AttackerParams.AddDefaulted_GetRef();
+			DamageParams.WorldContextObject = Attacker->GetAvatarActor();
+			DamageParams.SourceAbilitySystemComponent = Attacker;
+			DamageParams.BaseDamage = Damage;
+			for(const FAuraDamageTypeTags& DamageTypeTags : GameplayTags.DamageTypes)
+			{
+				FAuraDamageGameplayEffect DamageEffect;
+				DamageEffect.DamageEffectClass = DamageEffectClass;
+				DamageEffect.Damage = FScalableFloat(Damage);
+				DamageEffect.DebuffChance = FScalableFloat(DebuffChance);
+				DamageParams.DamageType.Add(DamageTypeTags.DamageType, DamageEffect);
+			}
+		}
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		const int32 UObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+		const uint64 UsedPhysicalBefore = FPlatformMemory::GetStats().UsedPhysical;
+		const uint64 ContextPoolMissesBefore = FAuraGameplayEffectContext::GetNumPoolMisses();
+
+		TArray<double> LatenciesUs;
+		LatenciesUs.Reserve(NumHits);
+		double TotalSeconds = 0.0;
+		int32 Applications = 0;
+		while(Applications < NumHits)
+		{
+			for(UAbilitySystemComponent* Target : Targets)
+			{
+				RefillHealth(Target);
+			}
+
+			if(bBatch)
+			{
+				for(int32 AttackerIndex = 0; AttackerIndex < Attackers.Num() && Applications < NumHits; AttackerIndex++)
+				{
+					const int32 BatchSize = FMath::Min(Targets.Num(), NumHits - Applications);
+					const double Start = FPlatformTime::Seconds();
+					UAuraAbilitySystemLibrary::ApplyDamageEffectBatch(AttackerParams[AttackerIndex], MakeArrayView(Targets.GetData(), BatchSize));
+					const double Elapsed = FPlatformTime::Seconds() - Start;
+					TotalSeconds += Elapsed;
+					// One sample per batch, individual hits inside a batch aren't timed
+					LatenciesUs.Add(Elapsed * 1000000.0);
+					Applications += BatchSize;
+				}
+			}
+			else
+			{
+				for(int32 TargetIndex = 0; TargetIndex < Targets.Num() && Applications < NumHits; TargetIndex++)
+				{
+					FDamageEffectParams& DamageParams = AttackerParams[Applications % Attackers.Num()];
+					DamageParams.TargetAbilitySystemComponent = Targets[TargetIndex];
+					const double Start = FPlatformTime::Seconds();
+					UAuraAbilitySystemLibrary::ApplyDamageEffect(DamageParams);
+					const double Elapsed = FPlatformTime::Seconds() - Start;
+					TotalSeconds += Elapsed;
+					LatenciesUs.Add(Elapsed * 1000000.0);
+					Applications++;
+				}
+			}
+		}
+
+		const int32 UObjectsCreated = GUObjectArray.GetObjectArrayNumMinusAvailable() - UObjectsBefore;
+		const double UsedPhysicalDeltaMB = (static_cast<double>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<double>(UsedPhysicalBefore)) / (1024.0 * 1024.0);
+		const double ContextAllocsPerHit = static_cast<double>(FAuraGameplayEffectContext::GetNumPoolMisses() - ContextPoolMissesBefore) / Applications;
+
+		const double GCStart = FPlatformTime::Seconds();
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		const double GCMs = (FPlatformTime::Seconds() - GCStart) * 1000.0;
+
+		LatenciesUs.Sort();
+		const double ApplicationsPerSecond = TotalSeconds > 0.0 ? Applications / TotalSeconds : 0.0;
+		const double P50 = Percentile(LatenciesUs, 0.5);
+		const double P99 = Percentile(LatenciesUs, 0.99);
+		const TCHAR* LatencySample = bBatch ? TEXT("batch") : TEXT("hit");
+
+		UE_LOG(LogAura, Log, TEXT("Aura.Bench.Combat: %d applications, %d targets, %d attackers, batch %d"), Applications, Targets.Num(), Attackers.Num(), bBatch ? 1 : 0);
+		UE_LOG(LogAura, Log, TEXT("  %.0f applications/sec, p50 %.2f us, p99 %.2f us per %s"), ApplicationsPerSecond, P50, P99, LatencySample);
+		UE_LOG(LogAura, Log, TEXT("  %d UObjects created, %.2f MB used physical delta, GC %.2f ms"), UObjectsCreated, UsedPhysicalDeltaMB, GCMs);
+		UE_LOG(LogAura, Log, TEXT("  %.4f effect context heap allocations per hit"), ContextAllocsPerHit);
+
+		const FString CsvPath = FPaths::ProfilingDir() / CsvName;
+		if(!FPaths::FileExists(CsvPath))
+		{
+			FFileHelper::SaveStringToFile(TEXT("Timestamp,Map,Targets,Attackers,Batch,Applications,ApplicationsPerSec,P50Us,P99Us,UObjectsCreated,UsedPhysicalDeltaMB,GCMs,ContextAllocsPerHit,LatencyPer\n"), *CsvPath);
+		}
+		const FString Row = FString::Printf(TEXT("%s,%s,%d,%d,%d,%d,%.1f,%.3f,%.3f,%d,%.3f,%.3f,%.4f,%s\n"),
+			*FDateTime::Now().ToString(), *World->GetMapName(), Targets.Num(), Attackers.Num(), bBatch ? 1 : 0, Applications,
+			ApplicationsPerSecond, P50, P99, UObjectsCreated, UsedPhysicalDeltaMB, GCMs, ContextAllocsPerHit, LatencySample);
+		FFileHelper::SaveStringToFile(Row, *CsvPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+		UE_LOG(LogAura, Log, TEXT("  written to %s"), *CsvPath);
+
+		if(!bKeep)
+		{
+			for(AAuraCharacterBase* Combatant : Spawned)
+			{
+				Combatant->Destroy();
+			}
+		}
+		return true;
+	}
+
+	// A standalone game world with the project's default game mode, so the combat benchmark needs no map, PIE session or player
+	static UGameInstance* CreateBenchmarkGame()
+	{
+		UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+		GameInstance->AddToRoot();
+		GameInstance->InitializeStandalone(TEXT("AuraCombatBench"));
+
+		UWorld* World = GameInstance->GetWorld();
+		const FURL URL;
+		World->SetGameMode(URL);
+		World->InitializeActorsForPlay(URL);
+		World->BeginPlay();
+		return GameInstance;
+	}
+
+	static void DestroyBenchmarkGame(UGameInstance* GameInstance)
+	{
+		UWorld* World = GameInstance->GetWorld();
+		World->BeginTearingDown();
+		for(FActorIterator It(World); It; ++It)
+		{
+			It->RouteEndPlay(EEndPlayReason::Quit);
+		}
+		GameInstance->Shutdown();
+		World->DestroyWorld(false);
+		GEngine->DestroyWorldContext(World);
+		GameInstance->RemoveFromRoot();
+	}
+
+	// The physics path GetLivePlayersWithinRadius took before the combatant registry
+	static void OverlapLiveCombatants(UWorld* World, const FVector& Origin, float Radius, TArray<AActor*>& OutActors)
+	{
+		TArray<FOverlapResult> Overlaps;
+		World->OverlapMultiByObjectType(Overlaps, Origin, FQuat::Identity, FCollisionObjectQueryParams(FCollisionObjectQueryParams::InitType::AllDynamicObjects), FCollisionShape::MakeSphere(Radius));
+		for(const FOverlapResult& Overlap : Overlaps)
+		{
+			if(Overlap.GetActor()->Implements<UCombatInterface>() && !ICombatInterface::Execute_IsDead(Overlap.GetActor()))
+			{
+				OutActors.AddUnique(ICombatInterface::Execute_GetAvatar(Overlap.GetActor()));
+			}
+		}
+	}
+
+	// The tag scan UBTService_FindNearestPlayer ran before the combatant registry
+	static AActor* ScanNearestWithTag(UWorld* World, const AActor* Querier, FName TargetTag)
+	{
+		TArray<AActor*> ActorsWithTag;
+		UGameplayStatics::GetAllActorsWithTag(World, TargetTag, ActorsWithTag);
+
+		float ClosestDistance = TNumericLimits<float>::Max();
+		AActor* ClosestActor = nullptr;
+		for(AActor* Actor : ActorsWithTag)
+		{
+			const float Distance = Querier->GetDistanceTo(Actor);
+			if(Distance < ClosestDistance)
+			{
+				ClosestDistance = Distance;
+				ClosestActor = Actor;
+			}
+		}
+		return ClosestActor;
+	}
+
+	static void RunCombatantRegistryBenchmark(const TArray<FString>& Args, UWorld* World)
+	{
+		UAuraCombatantRegistry* CombatantRegistry = UAuraCombatantRegistry::Get(World);
+		if(World == nullptr || CombatantRegistry == nullptr)
+		{
+			UE_LOG(LogAura, Warning, TEXT("%hs: needs a game world"), __FUNCTION__);
+			return;
+		}
+
+		const FString Params = FString::Join(Args, TEXT(" "));
+		int32 NumCombatants = 2000;
+		int32 NumQueries = 2000;
+		float Radius = 850.f;
+		int32 K = 5;
+		float Spacing = 200.f;
+		bool bKeep = false;
+		FString CombatantClassPath;
+		FParse::Value(*Params, TEXT("Combatants="), NumCombatants);
+		FParse::Value(*Params, TEXT("Queries="), NumQueries);
+		FParse::Value(*Params, TEXT("Radius="), Radius);
+		FParse::Value(*Params, TEXT("K="), K);
+		FParse::Value(*Params, TEXT("Spacing="), Spacing);
+		FParse::Bool(*Params, TEXT("Keep="), bKeep);
+		FParse::Value(*Params, TEXT("CombatantClass="), CombatantClassPath);
+		NumCombatants = FMath::Max(2, NumCombatants);
+		NumQueries = FMath::Max(1, NumQueries);
+
+		UClass* CombatantClass = CombatantClassPath.IsEmpty() ? AAuraEnemy::StaticClass() : LoadClass<AAuraCharacterBase>(nullptr, *CombatantClassPath);
+		if(CombatantClass == nullptr)
+		{
+			UE_LOG(LogAura, Warning, TEXT("%hs: could not load %s"), __FUNCTION__, *CombatantClassPath);
+			return;
+		}
+
+		// A square field, one in four tagged Player so hostile queries have both sides to pick from
+		const APlayerController* PC = World->GetFirstPlayerController();
+		const FVector Origin = PC && PC->GetPawn() ? PC->GetPawn()->GetActorLocation() : FVector::ZeroVector;
+		const int32 GridSide = FMath::CeilToInt32(FMath::Sqrt(static_cast<float>(NumCombatants)));
+		TArray<AAuraCharacterBase*> Spawned;
+		for(int32 i = 0; i < NumCombatants; i++)
+		{
+			const FVector Location = Origin + FVector((i % GridSide - GridSide / 2) * Spacing, (i / GridSide - GridSide / 2) * Spacing, 0.f);
+			if(AAuraCharacterBase* Combatant = SpawnCombatant(World, CombatantClass, Location, MakeFactionMask(i % 4 == 0 ? EAuraFaction::Player : EAuraFaction::Enemy)))
+			{
+				Spawned.Add(Combatant);
+			}
+		}
+		if(Spawned.Num() < 2)
+		{
+			UE_LOG(LogAura, Warning, TEXT("%hs: failed to spawn combatants"), __FUNCTION__);
+			return;
+		}
+
+		FRandomStream Random(1234);
+		TArray<AAuraCharacterBase*> Queriers;
+		for(int32 i = 0; i < NumQueries; i++)
+		{
+			Queriers.Add(Spawned[Random.RandRange(0, Spawned.Num() - 1)]);
+		}
+
+		const double RefreshStart = FPlatformTime::Seconds();
+		CombatantRegistry->RefreshLocations();
+		const double RefreshUs = (FPlatformTime::Seconds() - RefreshStart) * 1000000.0;
+
+		TArray<AActor*> Found;
+		int64 PhysicsFound = 0;
+		double Start = FPlatformTime::Seconds();
+		for(const AAuraCharacterBase* Querier : Queriers)
+		{
+			Found.Reset();
+			OverlapLiveCombatants(World, Querier->GetActorLocation(), Radius, Found);
+			PhysicsFound += Found.Num();
+		}
+		const double PhysicsRadiusUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumQueries;
+
+		int64 RegistryFound = 0;
+		Start = FPlatformTime::Seconds();
+		for(const AAuraCharacterBase* Querier : Queriers)
+		{
+			Found.Reset();
+			CombatantRegistry->GetAliveInRadius(Querier->GetActorLocation(), Radius, Found);
+			RegistryFound += Found.Num();
+		}
+		const double RegistryRadiusUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumQueries;
+
+		Start = FPlatformTime::Seconds();
+		for(const AAuraCharacterBase* Querier : Queriers)
+		{
+			Found.Reset();
+			CombatantRegistry->GetKNearest(Querier->GetActorLocation(), K, Radius, Found);
+		}
+		const double RegistryKNearestUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumQueries;
+
+		int32 Mismatches = 0;
+		Start = FPlatformTime::Seconds();
+		TArray<AActor*> ScanResults;
+		ScanResults.Reserve(NumQueries);
+		for(const AAuraCharacterBase* Querier : Queriers)
+		{
+			ScanResults.Add(ScanNearestWithTag(World, Querier, Querier->ActorHasTag(FName("Player")) ? FName("Enemy") : FName("Player")));
+		}
+		const double ScanHostileUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumQueries;
+
+		Start = FPlatformTime::Seconds();
+		for(int32 i = 0; i < NumQueries; i++)
+		{
+			float Distance = 0.f;
+			if(CombatantRegistry->FindNearestHostile(Queriers[i], Distance) != ScanResults[i])
+			{
+				Mismatches++;
+			}
+		}
+		const double RegistryHostileUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / NumQueries;
+
+		UE_LOG(LogAura, Log, TEXT("Aura.Bench.Combatants: %d combatants, %d queries, radius %.0f, k %d"), Spawned.Num(), NumQueries, Radius, K);
+		UE_LOG(LogAura, Log, TEXT("  refresh:         %.1f us per tick"), RefreshUs);
+		UE_LOG(LogAura, Log, TEXT("  radius physics:  %.2f us/query, %.1f found"), PhysicsRadiusUs, static_cast<double>(PhysicsFound) / NumQueries);
+		UE_LOG(LogAura, Log, TEXT("  radius registry: %.2f us/query, %.1f found"), RegistryRadiusUs, static_cast<double>(RegistryFound) / NumQueries);
+		UE_LOG(LogAura, Log, TEXT("  k-nearest:       %.2f us/query"), RegistryKNearestUs);
+		UE_LOG(LogAura, Log, TEXT("  hostile scan:    %.2f us/query"), ScanHostileUs);
+		UE_LOG(LogAura, Log, TEXT("  hostile registry %.2f us/query, %d/%d differ from the scan (ties)"), RegistryHostileUs, Mismatches, NumQueries);
+
+		if(!bKeep)
+		{
+			for(AAuraCharacterBase* Combatant : Spawned)
+			{
+				Combatant->Destroy();
+			}
+		}
+	}
+
+	// GetClosestTargets before the partial-select kernel: repeated minimum scans with Remove and AddUnique
+	static void LegacyClosestIndices(const TArray<FVector>& Locations, const FVector& Origin, int32 K, TArray<int32>& OutIndices)
+	{
+		TArray<int32> ToCheck;
+		for(int32 i = 0; i < Locations.Num(); i++)
+		{
+			ToCheck.Add(i);
+		}
+		while(OutIndices.Num() < K && ToCheck.Num() > 0)
+		{
+			double ClosestDistance = TNumericLimits<double>::Max();
+			int32 Closest = INDEX_NONE;
+			for(const int32 Index : ToCheck)
+			{
+				const double Distance = (Locations[Index] - Origin).Length();
+				if(Distance < ClosestDistance)
+				{
+					ClosestDistance = Distance;
+					Closest = Index;
+				}
+			}
+			ToCheck.Remove(Closest);
+			OutIndices.AddUnique(Closest);
+		}
+	}
+
+	static void RunClosestTargetsBenchmark(const TArray<FString>& Args)
+	{
+		const FString Params = FString::Join(Args, TEXT(" "));
+		int32 K = 5;
+		int32 Iterations = 200;
+		FParse::Value(*Params, TEXT("K="), K);
+		FParse::Value(*Params, TEXT("Iterations="), Iterations);
+		K = FMath::Max(1, K);
+		Iterations = FMath::Max(1, Iterations);
+
+		FRandomStream Random(1234);
+		UE_LOG(LogAura, Log, TEXT("Aura.Bench.ClosestTargets: k %d, %d iterations per size"), K, Iterations);
+		for(const int32 Num : { 10, 50, 100, 500, 1000, 2000, 5000 })
+		{
+			TArray<FVector> Locations;
+			for(int32 i = 0; i < Num; i++)
+			{
+				Locations.Add(FVector(Random.FRandRange(-5000.f, 5000.f), Random.FRandRange(-5000.f, 5000.f), Random.FRandRange(-200.f, 200.f)));
+			}
+			const FVector Origin(Random.FRandRange(-1000.f, 1000.f), Random.FRandRange(-1000.f, 1000.f), 0.f);
+
+			TArray<int32> Legacy;
+			double Start = FPlatformTime::Seconds();
+			for(int32 i = 0; i < Iterations; i++)
+			{
+				Legacy.Reset();
+				LegacyClosestIndices(Locations, Origin, K, Legacy);
+			}
+			const double LegacyUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / Iterations;
+
+			TArray<int32> Selected;
+			Start = FPlatformTime::Seconds();
+			for(int32 i = 0; i < Iterations; i++)
+			{
+				UAuraAbilitySystemLibrary::FindClosestIndices(Locations, Origin, K, Selected);
+			}
+			const double SelectUs = (FPlatformTime::Seconds() - Start) * 1000000.0 / Iterations;
+
+			UE_LOG(LogAura, Log, TEXT("  N=%5d  legacy %9.2f us  partial select %7.2f us  %s"), Num, LegacyUs, SelectUs, Legacy == Selected ? TEXT("match") : TEXT("MISMATCH"));
+		}
+	}
+
+	struct FEffectContextWireCase
+	{
+		const TCHAR* Name;
+		FAuraGameplayEffectContext Context;
+	};
+
+	static void RunEffectContextWireReport(const TArray<FString>& Args)
+	{
+		const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+
+		TArray<FEffectContextWireCase> Cases;
+		{
+			FEffectContextWireCase& Plain = Cases.Add_GetRef({ TEXT("plain hit") });
+			Plain.Context.SetDamageType(GameplayTags.Damage_Fire);
+
+			FEffectContextWireCase& Critical = Cases.Add_GetRef({ TEXT("critical + knockback") });
+			Critical.Context.SetIsCriticalHit(true);
+			Critical.Context.SetDamageType(GameplayTags.Damage_Physical);
+			Critical.Context.SetKnockBackForce(FVector(707.1f, -707.1f, 1000.f));
+
+			FEffectContextWireCase& Debuff = Cases.Add_GetRef({ TEXT("debuff + death impulse") });
+			Debuff.Context.SetIsSuccessfulDebuff(true);
+			Debuff.Context.SetDebuffDamage(5.f);
+			Debuff.Context.SetDebuffDuration(5.f);
+			Debuff.Context.SetDebuffFrequency(1.f);
+			Debuff.Context.SetDamageType(GameplayTags.Damage_Lightning);
+			Debuff.Context.SetDeathImpulse(FVector(3535.53f, 3535.53f, 5000.f));
+
+			FEffectContextWireCase& Blocked = Cases.Add_GetRef({ TEXT("blocked, non-table damage type") });
+			Blocked.Context.SetIsBlockedHit(true);
+			Blocked.Context.SetDamageType(GameplayTags.Damage);
+		}
+
+		// Size of the base FGameplayEffectContext part on its own, for reference
+		FGameplayEffectContext BaseContext;
+		FNetBitWriter BaseWriter(nullptr, 1024);
+		bool bBaseSuccess = true;
+		BaseContext.NetSerialize(BaseWriter, nullptr, bBaseSuccess);
+		UE_LOG(LogAura, Log, TEXT("Aura.Net.EffectContextWire: base FGameplayEffectContext without instigator/hit result = %lld bits"), BaseWriter.GetNumBits());
+
+		for(FEffectContextWireCase& Case : Cases)
+		{
+			FNetBitWriter Writer(nullptr, 1024);
+			bool bWriteSuccess = true;
+			Case.Context.NetSerialize(Writer, nullptr, bWriteSuccess);
+
+			UE_LOG(LogAura, Log, TEXT("  %-32s %4lld bits (%lld bytes) per hit"), Case.Name, Writer.GetNumBits(), (Writer.GetNumBits() + 7) / 8);
+		}
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs AuraBenchDamageBatchCommand(
+	TEXT("Aura.Bench.DamageBatch"),
+	TEXT("Aura.Bench.DamageBatch [Iterations=50] [MaxTargets=64]\n")
+	TEXT("Applies the local player's first damage ability to live enemies through the per-target ApplyDamageEffect loop and through ApplyDamageEffectBatch, then logs both timings.\n")
+	TEXT("Server only. Targets take real damage and are healed back to full before each phase, so run it on a test map."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if(World == nullptr || World->GetNetMode() == NM_Client)
+		{
+			UE_LOG(LogAura, Warning, TEXT("%hs: needs an authoritative game world"), __FUNCTION__);
+			return;
+		}
+
+		const int32 Iterations = FMath::Max(1, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 50);
+		const int32 MaxTargets = FMath::Max(1, Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 64);
+
+		FDamageEffectParams Params;
+		if(!AuraAbilitySystemBenchmarks::MakeLocalPlayerDamageParams(World, Params))
+		{
+			UE_LOG(LogAura, Warning, TEXT("%hs: local player has no damage ability"), __FUNCTION__);
+			return;
+		}
+
+		TArray<UAbilitySystemComponent*> Targets;
+		AuraAbilitySystemBenchmarks::GatherLiveEnemies(World, MaxTargets, Targets);
+		if(Targets.Num() == 0)
+		{
+			UE_LOG(LogAura, Warning, TEXT("%hs: no live enemies to hit"), __FUNCTION__);
+			return;
+		}
+
+		// Both phases hit full health targets and take turns going first, so neither is timed on dying targets or a warmer cache
+		double LoopSeconds = 0.0;
+		double BatchSeconds = 0.0;
+		for(int32 i = 0; i < Iterations; i++)
+		{
+			for(int32 Phase = 0; Phase < 2; Phase++)
+			{
+				for(UAbilitySystemComponent* TargetASC : Targets)
+				{
+					AuraAbilitySystemBenchmarks::RefillHealth(TargetASC);
+				}
+
+				const bool bBatchPhase = (Phase == 0) == (i % 2 == 1);
+				const double PhaseStart = FPlatformTime::Seconds();
+				if(bBatchPhase)
+				{
+					UAuraAbilitySystemLibrary::ApplyDamageEffectBatch(Params, Targets);
+					BatchSeconds += FPlatformTime::Seconds() - PhaseStart;
+				}
+				else
+				{
+					for(UAbilitySystemComponent* TargetASC : Targets)
+					{
+						Params.TargetAbilitySystemComponent = TargetASC;
+						UAuraAbilitySystemLibrary::ApplyDamageEffect(Params);
+					}
+					LoopSeconds += FPlatformTime::Seconds() - PhaseStart;
+				}
+			}
+		}
+
+		const double Applications = static_cast<double>(Iterations) * Targets.Num();
+		UE_LOG(LogAura, Log, TEXT("Aura.Bench.DamageBatch: %d targets x %d iterations, %d damage types"), Targets.Num(), Iterations, Params.DamageType.Num());
+		UE_LOG(LogAura, Log, TEXT("  per-target loop: %.3f ms total, %.2f us/target"), LoopSeconds * 1000.0, LoopSeconds * 1000000.0 / Applications);
+		UE_LOG(LogAura, Log, TEXT("  batch:           %.3f ms total, %.2f us/target"), BatchSeconds * 1000.0, BatchSeconds * 1000000.0 / Applications);
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs AuraBenchCombatCommand(
+	TEXT("Aura.Bench.Combat"),
+	TEXT("Aura.Bench.Combat [Enemies=200] [Attackers=16] [Hits=20000] [Damage=1] [DebuffChance=20] [Batch=0] [Keep=0] [EnemyClass=] [AttackerClass=] [DamageEffect=] [Csv=AuraCombatBench.csv]\n")
+	TEXT("Spawns AI-less combatants and drives synthetic hits of all four damage types, with debuffs, siphons and Halo of Protection, through the full damage pipeline.\n")
+	TEXT("Logs applications/sec, p50/p99 latency (per hit, or per batch with Batch=1), UObjects created, memory delta and GC time, and appends them to Saved/Profiling/<Csv>.\n")
+	TEXT("Runs in the current game world. The Aura.Bench.Combat automation test runs it headless in a world of its own:\n")
+	TEXT("UnrealEditor-Cmd Aura.uproject -nullrhi -unattended -ExecCmds=\"Automation RunTests Aura.Bench.Combat;Quit\""),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		AuraAbilitySystemBenchmarks::RunCombatBenchmark(Args, World);
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs AuraBenchCombatantsCommand(
+	TEXT("Aura.Bench.Combatants"),
+	TEXT("Aura.Bench.Combatants [Combatants=2000] [Queries=2000] [Radius=850] [K=5] [Spacing=200] [Keep=0] [CombatantClass=]\n")
+	TEXT("Spawns AI-less combatants on a grid and times radius, k-nearest and nearest-hostile queries through the combatant registry\n")
+	TEXT("against the physics overlap and actor tag scan they replaced."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&AuraAbilitySystemBenchmarks::RunCombatantRegistryBenchmark));
+
+static FAutoConsoleCommandWithArgs AuraBenchClosestTargetsCommand(
+	TEXT("Aura.Bench.ClosestTargets"),
+	TEXT("Aura.Bench.ClosestTargets [K=5] [Iterations=200]\n")
+	TEXT("Times the old repeated-scan GetClosestTargets against FindClosestIndices on random points for N=10..5000 and checks both pick the same targets in the same order."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&AuraAbilitySystemBenchmarks::RunClosestTargetsBenchmark));
+
+static FAutoConsoleCommandWithArgs AuraNetEffectContextWireCommand(
+	TEXT("Aura.Net.EffectContextWire"),
+	TEXT("Aura.Net.EffectContextWire\n")
+	TEXT("Logs the bits representative FAuraGameplayEffectContexts cost per hit through NetSerialize. The round trip itself is checked by the Aura.Net.EffectContext.RoundTrip automation test."),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&AuraAbilitySystemBenchmarks::RunEffectContextWireReport));
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FAuraCombatBenchmarkTest, "Aura.Bench.Combat",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+void FAuraCombatBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	OutBeautifiedNames.Add(TEXT("PerHit"));
+	OutTestCommands.Add(TEXT("Enemies=200 Attackers=16 Hits=20000"));
+	OutBeautifiedNames.Add(TEXT("Batch"));
+	OutTestCommands.Add(TEXT("Enemies=200 Attackers=16 Hits=20000 Batch=1"));
+}
+
+bool FAuraCombatBenchmarkTest::RunTest(const FString& Parameters)
+{
+	TArray<FString> Args;
+	Parameters.ParseIntoArrayWS(Args);
+
+	UGameInstance* GameInstance = AuraAbilitySystemBenchmarks::CreateBenchmarkGame();
+	const bool bRan = AuraAbilitySystemBenchmarks::RunCombatBenchmark(Args, GameInstance->GetWorld());
+	AuraAbilitySystemBenchmarks::DestroyBenchmarkGame(GameInstance);
+
+	TestTrue(TEXT("Combat benchmark ran"), bRan);
+	return true;
+}
+
+#endif
+
+#endif
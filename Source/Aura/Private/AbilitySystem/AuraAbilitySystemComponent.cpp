@@ -45,15 +45,12 @@ void UAuraAbilitySystemComponent::AbilityInputPressed(const FGameplayTag& InputT
 	if(!InputTag.IsValid()) return;
 
 	FScopedAbilityListLock AbilityLock(*this);
-	for(FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	if(FGameplayAbilitySpec* AbilitySpec = GetSpecWithSlot(InputTag))
 	{
-		if(AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag))
+		AbilitySpecInputPressed(*AbilitySpec);
+		if(AbilitySpec->IsActive())
 		{
-			AbilitySpecInputPressed(AbilitySpec);
-			if(AbilitySpec.IsActive())
-			{
-				InvokeReplicatedEvent(EAbilityGenericReplicatedEvent::InputPressed, AbilitySpec.Handle, AbilitySpec.GetAbilityInstances().Last()->GetCurrentActivationInfoRef().GetActivationPredictionKey());
-			}
+			InvokeReplicatedEvent(EAbilityGenericReplicatedEvent::InputPressed, AbilitySpec->Handle, AbilitySpec->GetAbilityInstances().Last()->GetCurrentActivationInfoRef().GetActivationPredictionKey());
 		}
 	}
 }
@@ -63,15 +60,12 @@ void UAuraAbilitySystemComponent::AbilityInputHeld(const FGameplayTag& InputTag)
 	if(!InputTag.IsValid()) return;
 
 	FScopedAbilityListLock AbilityLock(*this);
-	for(FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	if(FGameplayAbilitySpec* AbilitySpec = GetSpecWithSlot(InputTag))
 	{
-		if(AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag))
+		AbilitySpecInputPressed(*AbilitySpec);
+		if(!AbilitySpec->IsActive())
 		{
-			AbilitySpecInputPressed(AbilitySpec);
-			if(!AbilitySpec.IsActive())
-			{
-				TryActivateAbility(AbilitySpec.Handle);
-			}
+			TryActivateAbility(AbilitySpec->Handle);
 		}
 	}
 }
@@ -81,13 +75,11 @@ void UAuraAbilitySystemComponent::AbilityInputReleased(const FGameplayTag& Input
 	if(!InputTag.IsValid()) return;
 
 	FScopedAbilityListLock AbilityLock(*this);
-	for(FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	FGameplayAbilitySpec* AbilitySpec = GetSpecWithSlot(InputTag);
+	if(AbilitySpec && AbilitySpec->IsActive())
 	{
-		if(AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag) && AbilitySpec.IsActive())
-		{
-			AbilitySpecInputReleased(AbilitySpec);
-			InvokeReplicatedEvent(EAbilityGenericReplicatedEvent::InputReleased, AbilitySpec.Handle, AbilitySpec.GetAbilityInstances().Last()->GetCurrentActivationInfoRef().GetActivationPredictionKey());
-		}
+		AbilitySpecInputReleased(*AbilitySpec);
+		InvokeReplicatedEvent(EAbilityGenericReplicatedEvent::InputReleased, AbilitySpec->Handle, AbilitySpec->GetAbilityInstances().Last()->GetCurrentActivationInfoRef().GetActivationPredictionKey());
 	}
 }
 
@@ -109,7 +101,7 @@ FGameplayTag UAuraAbilitySystemComponent::GetAbilityTagFromSpec(const FGameplayA
 	{
 		for(FGameplayTag Tag : AbilitySpec.Ability->GetAssetTags())
 		{
-			if(Tag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("Abilities"))))
+			if(Tag.MatchesTag(FAuraGameplayTags::Get().Abilities))
 			{
 				return Tag;
 			}
@@ -123,7 +115,7 @@ FGameplayTag UAuraAbilitySystemComponent::GetInputTagFromSpec(const FGameplayAbi
 {
 	for(FGameplayTag Tag : AbilitySpec.GetDynamicSpecSourceTags())
 	{
-		if(Tag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("InputTag"))))
+		if(Tag.MatchesTag(FAuraGameplayTags::Get().InputTag))
 		{
 			return Tag;
 		}
@@ -136,7 +128,7 @@ FGameplayTag UAuraAbilitySystemComponent::GetStatusFromSpec(const FGameplayAbili
 {
 	for(FGameplayTag StatusTag : AbilitySpec.GetDynamicSpecSourceTags())
 	{
-		if(StatusTag.MatchesTag(FGameplayTag::RequestGameplayTag(FName("Abilities.Status"))))
+		if(StatusTag.MatchesTag(FAuraGameplayTags::Get().Abilities_Status))
 		{
 			return StatusTag;
 		}
@@ -146,9 +138,11 @@ FGameplayTag UAuraAbilitySystemComponent::GetStatusFromSpec(const FGameplayAbili
 
 FGameplayTag UAuraAbilitySystemComponent::GetStatusFromAbilityTag(const FGameplayTag& AbilityTag)
 {
-	if(const FGameplayAbilitySpec* AbilitySpec = GetSpecFromAbilityTag(AbilityTag))
+	// The index files every spec under its status, no need to walk the spec's dynamic tags
+	ConditionalRebuildAbilitySpecIndex();
+	if(const FGameplayAbilitySpecHandle* Handle = AbilityTagToHandle.Find(AbilityTag))
 	{
-		return GetStatusFromSpec(*AbilitySpec);
+		return AbilitySpecIndex.FindChecked(*Handle).StatusTag;
 	}
 	return FGameplayTag();
 }
@@ -164,15 +158,7 @@ FGameplayTag UAuraAbilitySystemComponent::GetSlotFromAbilityTag(const FGameplayT
 
 bool UAuraAbilitySystemComponent::SlotIsEmpty(const FGameplayTag& Slot)
 {
-	FScopedAbilityListLock ActiveScopedLock(*this);
-	for (FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
-	{
-		if (AbilityHasSlot(AbilitySpec, Slot))
-		{
-			return false;
-		}
-	}
-	return true;
+	return GetSpecWithSlot(Slot) == nullptr;
 }
 
 bool UAuraAbilitySystemComponent::AbilityHasSlot(const FGameplayAbilitySpec& Spec, const FGameplayTag& Slot)
@@ -182,27 +168,21 @@ bool UAuraAbilitySystemComponent::AbilityHasSlot(const FGameplayAbilitySpec& Spe
 
 bool UAuraAbilitySystemComponent::AbilityHasAnySlot(const FGameplayAbilitySpec& Spec)
 {
-	return Spec.GetDynamicSpecSourceTags().HasTag(FGameplayTag::RequestGameplayTag(FName("InputTag")));
+	return Spec.GetDynamicSpecSourceTags().HasTag(FAuraGameplayTags::Get().InputTag);
 }
 
 FGameplayAbilitySpec* UAuraAbilitySystemComponent::GetSpecWithSlot(const FGameplayTag& Slot)
 {
-	FScopedAbilityListLock ActiveScopedLock(*this);
-	for(FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
-	{
-		if(AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(Slot))
-		{
-			return &AbilitySpec;
-		}
-	}
-	return nullptr;
+	ConditionalRebuildAbilitySpecIndex();
+	const FGameplayAbilitySpecHandle* Handle = InputTagToHandle.Find(Slot);
+	return Handle ? FindIndexedSpec(*Handle) : nullptr;
 }
 
 bool UAuraAbilitySystemComponent::IsPassiveAbility(const FGameplayAbilitySpec& Spec) const
 {
 	const UAbilityInfo* AbilityInfo = UAuraAbilitySystemLibrary::GetAbilityInfo(GetAvatarActor());
 	const FGameplayTag AbilityTag = GetAbilityTagFromSpec(Spec);
-	const FAuraAbilityInfo& Info = AbilityInfo->FindAbilityInfoForTag(AbilityTag);
+	const FAuraAbilityInfo& Info = AbilityInfo->GetAbilityInfoForTag(AbilityTag);
 	const FGameplayTag AbilityType = Info.AbilityType;
 
 	return AbilityType.MatchesTagExact(FAuraGameplayTags::Get().Abilities_Type_Passive);
@@ -221,18 +201,9 @@ void UAuraAbilitySystemComponent::MulticastActivatePassiveEffect_Implementation(
 
 FGameplayAbilitySpec* UAuraAbilitySystemComponent::GetSpecFromAbilityTag(const FGameplayTag& AbilityTag)
 {
-	FScopedAbilityListLock ActiveScopedLock(*this);
-	for(FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
-	{
-		for(FGameplayTag Tag : AbilitySpec.Ability.Get()->GetAssetTags())
-		{
-			if(Tag.MatchesTag(AbilityTag))
-			{
-				return &AbilitySpec;
-			}
-		}
-	}
-	return nullptr;
+	ConditionalRebuildAbilitySpecIndex();
+	const FGameplayAbilitySpecHandle* Handle = AbilityTagToHandle.Find(AbilityTag);
+	return Handle ? FindIndexedSpec(*Handle) : nullptr;
 }
 
 void UAuraAbilitySystemComponent::UpgradeAttribute(const FGameplayTag& AttributeTag)
@@ -298,10 +269,12 @@ void UAuraAbilitySystemComponent::ServerSpendSpellPoint_Implementation(const FGa
 			AbilitySpec->GetDynamicSpecSourceTags().RemoveTag(GameplayTags.Abilities_Status_Eligible);
 			AbilitySpec->GetDynamicSpecSourceTags().AddTag(GameplayTags.Abilities_Status_Unlocked);
 			Status = GameplayTags.Abilities_Status_Unlocked;
+			IndexAbilitySpec(*AbilitySpec);
 		}
 		else if(Status.MatchesTagExact(GameplayTags.Abilities_Status_Equipped) || Status.MatchesTagExact(GameplayTags.Abilities_Status_Unlocked))
 		{
 			AbilitySpec->Level += 1;
+			UpdatePassiveAbilityLevel(*AbilitySpec);
 		}
 		ClientUpdateAbilityStatus(AbilityTag, Status, AbilitySpec->Level);
 		MarkAbilitySpecDirty(*AbilitySpec);
@@ -343,6 +316,7 @@ void UAuraAbilitySystemComponent::ServerEquipAbility_Implementation(const FGamep
 
 					// Clear the slot from the existing ability
 					ClearSlot(SpecWithSlot);
+					IndexAbilitySpec(*SpecWithSlot);
 				}
 			}
 
@@ -357,6 +331,7 @@ void UAuraAbilitySystemComponent::ServerEquipAbility_Implementation(const FGamep
 			}
 			// Now assign this ability to this slot
 			AssignSlotToAbility(*AbilitySpec, SlotTag);
+			IndexAbilitySpec(*AbilitySpec);
 			MarkAbilitySpecDirty(*AbilitySpec);
 		}
 		ClientEquipAbility(AbilityTag, GameplayTags.Abilities_Status_Equipped, SlotTag, PrefSlot);
@@ -373,7 +348,7 @@ bool UAuraAbilitySystemComponent::GetDescriptionsByAbilityTag(const FGameplayTag
                                                               FString& OutNextLevelDescription)
 {
 	const UAbilityInfo* AbilityInfo = UAuraAbilitySystemLibrary::GetAbilityInfo(GetAvatarActor());
-	const FAuraAbilityInfo AuraAbilityInfo = AbilityInfo->FindAbilityInfoForTag(AbilityTag);
+	const FAuraAbilityInfo& AuraAbilityInfo = AbilityInfo->GetAbilityInfoForTag(AbilityTag);
 	
 	if(const FGameplayAbilitySpec* AbilitySpec = GetSpecFromAbilityTag(AbilityTag))
 	{
@@ -405,13 +380,10 @@ void UAuraAbilitySystemComponent::ClearSlot(FGameplayAbilitySpec* Spec)
 
 void UAuraAbilitySystemComponent::ClearAbilityOfSlot(const FGameplayTag& Slot)
 {
-	FScopedAbilityListLock AbilityLock(*this);
-	for(FGameplayAbilitySpec& AbilitySpec : GetActivatableAbilities())
+	if(FGameplayAbilitySpec* AbilitySpec = GetSpecWithSlot(Slot))
 	{
-		if(AbilityHasSlot(&AbilitySpec, Slot))
-		{
-			ClearSlot(&AbilitySpec);
-		}
+		ClearSlot(AbilitySpec);
+		IndexAbilitySpec(*AbilitySpec);
 	}
 }
 
@@ -427,10 +399,152 @@ bool UAuraAbilitySystemComponent::AbilityHasSlot(FGameplayAbilitySpec* Spec, con
 	return false;
 }
 
+void UAuraAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+
+	// GiveAbility appends, so the new spec is normally the last one
+	const TArray<FGameplayAbilitySpec>& Specs = GetActivatableAbilities();
+	const int32 SpecIndex = Specs.Num() > 0 && &Specs.Last() == &AbilitySpec ? Specs.Num() - 1 : INDEX_NONE;
+	IndexAbilitySpec(AbilitySpec, SpecIndex);
+	UpdatePassiveAbilityLevel(AbilitySpec);
+}
+
+void UAuraAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	UnindexAbilitySpec(AbilitySpec.Handle);
+	UpdatePassiveAbilityLevel(AbilitySpec, true);
+	Super::OnRemoveAbility(AbilitySpec);
+}
+
+void UAuraAbilitySystemComponent::IndexAbilitySpec(const FGameplayAbilitySpec& AbilitySpec, int32 SpecIndex)
+{
+	if(SpecIndex == INDEX_NONE)
+	{
+		if(const FAbilitySpecIndexEntry* PreviousEntry = AbilitySpecIndex.Find(AbilitySpec.Handle))
+		{
+			SpecIndex = PreviousEntry->SpecIndex;
+		}
+	}
+	UnindexAbilitySpec(AbilitySpec.Handle);
+	if(AbilitySpec.Ability == nullptr) return;
+
+	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+	FAbilitySpecIndexEntry& Entry = AbilitySpecIndex.Add(AbilitySpec.Handle);
+	Entry.SpecIndex = SpecIndex;
+
+	for(const FGameplayTag& Tag : AbilitySpec.Ability->GetAssetTags())
+	{
+		if(Tag.MatchesTag(GameplayTags.Abilities))
+		{
+			Entry.AbilityTags.Add(Tag);
+			AbilityTagToHandle.Add(Tag, AbilitySpec.Handle);
+		}
+	}
+
+	Entry.InputTag = GetInputTagFromSpec(AbilitySpec);
+	if(Entry.InputTag.IsValid())
+	{
+		InputTagToHandle.Add(Entry.InputTag, AbilitySpec.Handle);
+	}
+
+	Entry.StatusTag = GetStatusFromSpec(AbilitySpec);
+}
+
+void UAuraAbilitySystemComponent::UnindexAbilitySpec(const FGameplayAbilitySpecHandle& Handle)
+{
+	FAbilitySpecIndexEntry Entry;
+	if(!AbilitySpecIndex.RemoveAndCopyValue(Handle, Entry)) return;
+
+	// Only drop lookups that still point at this spec, another spec may have taken the tag since
+	for(const FGameplayTag& Tag : Entry.AbilityTags)
+	{
+		if(const FGameplayAbilitySpecHandle* Indexed = AbilityTagToHandle.Find(Tag); Indexed && *Indexed == Handle)
+		{
+			AbilityTagToHandle.Remove(Tag);
+		}
+	}
+	if(const FGameplayAbilitySpecHandle* Indexed = InputTagToHandle.Find(Entry.InputTag); Indexed && *Indexed == Handle)
+	{
+		InputTagToHandle.Remove(Entry.InputTag);
+	}
+}
+
+void UAuraAbilitySystemComponent::RebuildAbilitySpecIndex()
+{
+	AbilitySpecIndex.Reset();
+	AbilityTagToHandle.Reset();
+	InputTagToHandle.Reset();
+	PassiveAbilityLevels.Reset();
+	bAbilitySpecIndexDirty = false;
+
+	const TArray<FGameplayAbilitySpec>& Specs = GetActivatableAbilities();
+	for(int32 SpecIndex = 0; SpecIndex < Specs.Num(); SpecIndex++)
+	{
+		IndexAbilitySpec(Specs[SpecIndex], SpecIndex);
+		UpdatePassiveAbilityLevel(Specs[SpecIndex]);
+	}
+}
+
+void UAuraAbilitySystemComponent::ConditionalRebuildAbilitySpecIndex()
+{
+	if(bAbilitySpecIndexDirty)
+	{
+		RebuildAbilitySpecIndex();
+	}
+}
+
+int32 UAuraAbilitySystemComponent::GetPassiveAbilityLevel(const FGameplayTag& PassiveAbilityTag) const
+{
+	// Rebuilding only refreshes the lookups from the replicated specs, it doesn't change the component's state
+	const_cast<UAuraAbilitySystemComponent*>(this)->ConditionalRebuildAbilitySpecIndex();
+	const int32* Level = PassiveAbilityLevels.Find(PassiveAbilityTag);
+	return Level ? *Level : 0;
+}
+
+FGameplayAbilitySpec* UAuraAbilitySystemComponent::FindIndexedSpec(const FGameplayAbilitySpecHandle& Handle)
+{
+	FAbilitySpecIndexEntry* Entry = AbilitySpecIndex.Find(Handle);
+	if(Entry == nullptr) return nullptr;
+
+	TArray<FGameplayAbilitySpec>& Specs = GetActivatableAbilities();
+	if(!Specs.IsValidIndex(Entry->SpecIndex) || Specs[Entry->SpecIndex].Handle != Handle)
+	{
+		// Removing an ability swaps specs around, look it up once and remember where it went
+		Entry->SpecIndex = Specs.IndexOfByPredicate([&Handle](const FGameplayAbilitySpec& Spec) { return Spec.Handle == Handle; });
+		if(Entry->SpecIndex == INDEX_NONE) return nullptr;
+	}
+	return &Specs[Entry->SpecIndex];
+}
+
+void UAuraAbilitySystemComponent::UpdatePassiveAbilityLevel(const FGameplayAbilitySpec& AbilitySpec, bool bRemoved)
+{
+	if(AbilitySpec.Ability == nullptr) return;
+
+	const FGameplayTag& PassiveParentTag = FAuraGameplayTags::Get().Abilities_Passive;
+	for(const FGameplayTag& Tag : AbilitySpec.Ability->GetAssetTags())
+	{
+		if(Tag.MatchesTag(PassiveParentTag) && Tag != PassiveParentTag)
+		{
+			if(bRemoved)
+			{
+				PassiveAbilityLevels.Remove(Tag);
+			}
+			else
+			{
+				PassiveAbilityLevels.Add(Tag, AbilitySpec.Level);
+			}
+		}
+	}
+}
+
 void UAuraAbilitySystemComponent::OnRep_ActivateAbilities()
 {
 	Super::OnRep_ActivateAbilities();
 
+	// Slot, status and level changes arrive without a give/remove, refresh from the replicated specs the next time a lookup needs them
+	bAbilitySpecIndexDirty = true;
+
 	if(!bStartupAbilitiesGiven)
 	{
 		bStartupAbilitiesGiven = true;
@@ -4,8 +4,93 @@
 #include "AbilitySystem/AuraAbilitySystemGlobals.h"
 
 #include "AuraAbilityTypes.h"
+#include "GameplayEffect.h"
+#include "AbilitySystem/AuraAttributeSet.h"
+#include "Aura/AuraStats.h"
+#include "GameplayEffectComponents/TargetTagsGameplayEffectComponent.h"
 
 FGameplayEffectContext* UAuraAbilitySystemGlobals::AllocGameplayEffectContext() const
 {
+	// Served from the calling thread's context pool, see FAuraGameplayEffectContext::operator new
 	return new FAuraGameplayEffectContext();
 }
+
+void UAuraAbilitySystemGlobals::InitRuntimeEffects()
+{
+	if(DebuffEffects.Num() > 0) return;
+
+	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+	for(const FAuraDamageTypeTags& DamageTypeTags : GameplayTags.DamageTypes)
+	{
+		DebuffEffects.Add(MakeDebuffEffect(DamageTypeTags));
+	}
+
+	SiphonEffects.SetNum(static_cast<int32>(EAuraSiphonType::MAX));
+	SiphonEffects[static_cast<int32>(EAuraSiphonType::Life)] = MakeSiphonEffect(FName("LifeSiphon"), UAuraAttributeSet::GetHealthAttribute(), GameplayTags.Abilities_Passive_LifeSiphon);
+	SiphonEffects[static_cast<int32>(EAuraSiphonType::Mana)] = MakeSiphonEffect(FName("ManaSiphon"), UAuraAttributeSet::GetManaAttribute(), GameplayTags.Abilities_Passive_ManaSiphon);
+}
+
+UGameplayEffect* UAuraAbilitySystemGlobals::MakeDebuffEffect(const FAuraDamageTypeTags& DamageTypeTags)
+{
+	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+	
+	FString DebuffName = DamageTypeTags.Debuff.ToString();
+	DebuffName.ReplaceCharInline(TEXT('.'), TEXT('_'));
+	UGameplayEffect* GameplayEffect = NewObject<UGameplayEffect>(this, FName(DebuffName));
+	INC_DWORD_STAT(STAT_Aura_RuntimeEffectsCreated);
+
+	FSetByCallerFloat DurationByCaller;
+	DurationByCaller.DataTag = GameplayTags.Debuff_Duration;
+	GameplayEffect->DurationPolicy = EGameplayEffectDurationType::HasDuration;
+	GameplayEffect->DurationMagnitude = FGameplayEffectModifierMagnitude(DurationByCaller);
+	
+	// Overwritten on the spec by the hit's debuff frequency
+	GameplayEffect->Period = 1.f;
+
+	FInheritedTagContainer TagContainer = FInheritedTagContainer();
+	UTargetTagsGameplayEffectComponent& AssetTagsComponent = GameplayEffect->FindOrAddComponent<UTargetTagsGameplayEffectComponent>();
+	
+	TagContainer.Added.AddTag(DamageTypeTags.Debuff);
+	TagContainer.CombinedTags.AddTag(DamageTypeTags.Debuff);
+	if (DamageTypeTags.Debuff.MatchesTagExact(GameplayTags.Debuff_Stun))
+	{
+		TagContainer.Added.AddTag(GameplayTags.Player_Block_CursorTrace);
+		TagContainer.Added.AddTag(GameplayTags.Player_Block_InputPressed);
+		TagContainer.Added.AddTag(GameplayTags.Player_Block_InputHeld);
+		TagContainer.Added.AddTag(GameplayTags.Player_Block_InputReleased);
+	}
+	
+	AssetTagsComponent.SetAndApplyTargetTagChanges(TagContainer);
+
+	// Every proc used to build its own effect, so procs never stacked with each other. No stacking keeps each proc
+	// an independent application with its own period, damage and duration.
+	GameplayEffect->StackingType = EGameplayEffectStackingType::None;
+
+	FSetByCallerFloat DamageByCaller;
+	DamageByCaller.DataTag = GameplayTags.Debuff_Damage;
+	
+	FGameplayModifierInfo& ModifierInfo = GameplayEffect->Modifiers.AddDefaulted_GetRef();
+	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(DamageByCaller);
+	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
+	ModifierInfo.Attribute = UAuraAttributeSet::GetIncomingDamageAttribute();
+
+	return GameplayEffect;
+}
+
+UGameplayEffect* UAuraAbilitySystemGlobals::MakeSiphonEffect(const FName& EffectName, const FGameplayAttribute& Attribute, const FGameplayTag& MagnitudeTag)
+{
+	UGameplayEffect* GameplayEffect = NewObject<UGameplayEffect>(this, EffectName);
+	INC_DWORD_STAT(STAT_Aura_RuntimeEffectsCreated);
+
+	GameplayEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FSetByCallerFloat AmountByCaller;
+	AmountByCaller.DataTag = MagnitudeTag;
+
+	FGameplayModifierInfo& ModifierInfo = GameplayEffect->Modifiers.AddDefaulted_GetRef();
+	ModifierInfo.ModifierMagnitude = FGameplayEffectModifierMagnitude(AmountByCaller);
+	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
+	ModifierInfo.Attribute = Attribute;
+
+	return GameplayEffect;
+}
@@ -5,15 +5,24 @@
 
 #include "AbilitySystemBlueprintLibrary.h"
 #include "AbilitySystemComponent.h"
+#include "Algo/Sort.h"
 #include "AuraAbilityTypes.h"
 #include "AuraGameplayTags.h"
 #include "AbilitySystem/Abilities/AuraDamageGameplayAbility.h"
+#include "Game/AuraCombatantRegistry.h"
+#include "Game/AuraCombatRandomSubsystem.h"
 #include "Game/AuraGameModeBase.h"
 #include "Interaction/CombatInterface.h"
 #include "Kismet/GameplayStatics.h"
 #include "UI/WidgetController/AuraWidgetController.h"
 #include "Player/AuraPlayerState.h"
 #include "UI/HUD/AuraHUD.h"
+#include "Aura/AuraStats.h"
+
+#include <algorithm>
+
+DECLARE_CYCLE_STAT(TEXT("ApplyDamageEffect"), STAT_Aura_ApplyDamageEffect, STATGROUP_Aura);
+DECLARE_CYCLE_STAT(TEXT("ApplyDamageEffectBatch"), STAT_Aura_ApplyDamageEffectBatch, STATGROUP_Aura);
 
 bool UAuraAbilitySystemLibrary::MakeWidgetControllerParams(const UObject* WorldContextObject, FWidgetControllerParams& WidgetControllerParams, AAuraHUD*& OutAuraHUD)
 {
@@ -161,41 +170,38 @@ bool UAuraAbilitySystemLibrary::IsSuccessfulDebuff(const FGameplayEffectContextH
 	return false;
 }
 
-FScalableFloat UAuraAbilitySystemLibrary::GetDebuffDamage(const FGameplayEffectContextHandle& EffectContextHandle)
+float UAuraAbilitySystemLibrary::GetDebuffDamage(const FGameplayEffectContextHandle& EffectContextHandle)
 {
 	if(const FAuraGameplayEffectContext* AuraEffectContext = static_cast<const FAuraGameplayEffectContext*>(EffectContextHandle.Get()))
 	{
 		return AuraEffectContext->GetDebuffDamage();
 	}
-	return FScalableFloat();
+	return 0.f;
 }
 
-FScalableFloat UAuraAbilitySystemLibrary::GetDebuffDuration(const FGameplayEffectContextHandle& EffectContextHandle)
+float UAuraAbilitySystemLibrary::GetDebuffDuration(const FGameplayEffectContextHandle& EffectContextHandle)
 {
 	if(const FAuraGameplayEffectContext* AuraEffectContext = static_cast<const FAuraGameplayEffectContext*>(EffectContextHandle.Get()))
 	{
 		return AuraEffectContext->GetDebuffDuration();
 	}
-	return FScalableFloat();
+	return 0.f;
 }
 
-FScalableFloat UAuraAbilitySystemLibrary::GetDebuffFrequency(const FGameplayEffectContextHandle& EffectContextHandle)
+float UAuraAbilitySystemLibrary::GetDebuffFrequency(const FGameplayEffectContextHandle& EffectContextHandle)
 {
 	if(const FAuraGameplayEffectContext* AuraEffectContext = static_cast<const FAuraGameplayEffectContext*>(EffectContextHandle.Get()))
 	{
 		return AuraEffectContext->GetDebuffFrequency();
 	}
-	return FScalableFloat();
+	return 0.f;
 }
 
 FGameplayTag UAuraAbilitySystemLibrary::GetDamageType(const FGameplayEffectContextHandle& EffectContextHandle)
 {
 	if(const FAuraGameplayEffectContext* AuraEffectContext = static_cast<const FAuraGameplayEffectContext*>(EffectContextHandle.Get()))
 	{
-		if(AuraEffectContext->GetDamageType().IsValid())
-		{
-			return *AuraEffectContext->GetDamageType();
-		}
+		return AuraEffectContext->GetDamageType();
 	}
 	return FGameplayTag();
 }
@@ -243,7 +249,7 @@ void UAuraAbilitySystemLibrary::SetIsSuccessfulDebuff(FGameplayEffectContextHand
 	}
 }
 
-void UAuraAbilitySystemLibrary::SetDebuffDamage(FGameplayEffectContextHandle& EffectContextHandle, FScalableFloat InDebuffDamage)
+void UAuraAbilitySystemLibrary::SetDebuffDamage(FGameplayEffectContextHandle& EffectContextHandle, float InDebuffDamage)
 {
 	if(FAuraGameplayEffectContext* AuraEffectContext = static_cast<FAuraGameplayEffectContext*>(EffectContextHandle.Get()))
 	{
@@ -252,7 +258,7 @@ void UAuraAbilitySystemLibrary::SetDebuffDamage(FGameplayEffectContextHandle& Ef
 }
 
 void UAuraAbilitySystemLibrary::SetDebuffDuration(FGameplayEffectContextHandle& EffectContextHandle,
-	FScalableFloat InDebuffDuration)
+	float InDebuffDuration)
 {
 	if(FAuraGameplayEffectContext* AuraEffectContext = static_cast<FAuraGameplayEffectContext*>(EffectContextHandle.Get()))
 	{
@@ -261,7 +267,7 @@ void UAuraAbilitySystemLibrary::SetDebuffDuration(FGameplayEffectContextHandle&
 }
 
 void UAuraAbilitySystemLibrary::SetDebuffFrequency(FGameplayEffectContextHandle& EffectContextHandle,
-	FScalableFloat InDebuffFrequency)
+	float InDebuffFrequency)
 {
 	if(FAuraGameplayEffectContext* AuraEffectContext = static_cast<FAuraGameplayEffectContext*>(EffectContextHandle.Get()))
 	{
@@ -274,8 +280,7 @@ void UAuraAbilitySystemLibrary::SetDamageType(FGameplayEffectContextHandle& Effe
 {
 	if(FAuraGameplayEffectContext* AuraEffectContext = static_cast<FAuraGameplayEffectContext*>(EffectContextHandle.Get()))
 	{
-		const TSharedPtr<FGameplayTag> DamageType = MakeShared<FGameplayTag>(InDamageType);
-		AuraEffectContext->SetDamageType(DamageType); 
+		AuraEffectContext->SetDamageType(InDamageType);
 	}
 }
 
@@ -301,6 +306,13 @@ void UAuraAbilitySystemLibrary::GetLivePlayersWithinRadius(const UObject* WorldC
                                                            TArray<AActor*>& OutOverlappingActors, const TArray<AActor*>& ActorsToIgnore, float Radius,
                                                            const FVector& SphereOrigin)
 {
+	if(const UAuraCombatantRegistry* CombatantRegistry = UAuraCombatantRegistry::Get(WorldContextObject))
+	{
+		CombatantRegistry->GetAliveInRadius(SphereOrigin, Radius, OutOverlappingActors, ActorsToIgnore);
+		return;
+	}
+
+	// No registry outside game worlds, fall back to a physics overlap
 	FCollisionQueryParams SphereParams;
 	SphereParams.AddIgnoredActors(ActorsToIgnore);
 
@@ -326,40 +338,103 @@ void UAuraAbilitySystemLibrary::GetClosestTargets(int32 MaxTargets, const TArray
 		OutClosestTargets = Actors;
 		return;
 	}
+	if(MaxTargets <= 0) return;
 
-	TArray<AActor*> ActorsToCheck = Actors;
-	int32 NumTargetsFound = 0;
+	TArray<FVector, TInlineAllocator<64>> Locations;
+	Locations.Reserve(Actors.Num());
+	for(const AActor* Actor : Actors)
+	{
+		Locations.Add(Actor->GetActorLocation());
+	}
 
-	while(NumTargetsFound < MaxTargets)
+	TArray<int32> ClosestIndices;
+	const int32 NumTargetsBefore = OutClosestTargets.Num();
+	FindClosestIndices(Locations, Origin, MaxTargets, ClosestIndices);
+	for(const int32 Index : ClosestIndices)
 	{
-		if(ActorsToCheck.Num() == 0) break;
-		double ClosestDistance = TNumericLimits<double>::Max();
-		AActor* ClosestActor = nullptr;
-		for(AActor* PotentialTarget : ActorsToCheck)
+		OutClosestTargets.AddUnique(Actors[Index]);
+	}
+
+	// Duplicate actors in the input each took a slot, rank everything and keep going past them
+	if(OutClosestTargets.Num() - NumTargetsBefore < ClosestIndices.Num())
+	{
+		FindClosestIndices(Locations, Origin, Locations.Num(), ClosestIndices);
+		for(int32 i = MaxTargets; i < ClosestIndices.Num() && OutClosestTargets.Num() - NumTargetsBefore < MaxTargets; i++)
 		{
-			const double Distance = (PotentialTarget->GetActorLocation() - Origin).Length();
-			if(Distance < ClosestDistance)
-			{
-				ClosestDistance = Distance;
-				ClosestActor = PotentialTarget;
-			}
+			OutClosestTargets.AddUnique(Actors[ClosestIndices[i]]);
 		}
-		ActorsToCheck.Remove(ClosestActor);
-		OutClosestTargets.AddUnique(ClosestActor);
-		++NumTargetsFound;
+	}
+}
+
+void UAuraAbilitySystemLibrary::FindClosestIndices(TConstArrayView<FVector> Locations, const FVector& Origin, int32 K, TArray<int32>& OutIndices)
+{
+	OutIndices.Reset();
+	const int32 Num = Locations.Num();
+	K = FMath::Min(K, Num);
+	if(K <= 0) return;
+
+	// Origin-relative float lanes padded to a multiple of four, reused across calls on the same thread
+	struct FScratch
+	{
+		TArray<float> X, Y, Z, DistSquared;
+		TArray<uint64> Keys;
+	};
+	static thread_local FScratch Scratch;
+	const int32 PaddedNum = Align(Num, 4);
+	Scratch.X.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	Scratch.Y.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	Scratch.Z.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	Scratch.DistSquared.SetNumUninitialized(PaddedNum, EAllowShrinking::No);
+	for(int32 i = 0; i < Num; i++)
+	{
+		const FVector Offset = Locations[i] - Origin;
+		Scratch.X[i] = static_cast<float>(Offset.X);
+		Scratch.Y[i] = static_cast<float>(Offset.Y);
+		Scratch.Z[i] = static_cast<float>(Offset.Z);
+	}
+	for(int32 i = Num; i < PaddedNum; i++)
+	{
+		Scratch.X[i] = Scratch.Y[i] = Scratch.Z[i] = 0.f;
+	}
+
+	for(int32 i = 0; i < PaddedNum; i += 4)
+	{
+		const VectorRegister4Float X = VectorLoad(&Scratch.X[i]);
+		const VectorRegister4Float Y = VectorLoad(&Scratch.Y[i]);
+		const VectorRegister4Float Z = VectorLoad(&Scratch.Z[i]);
+		VectorStore(VectorMultiplyAdd(Z, Z, VectorMultiplyAdd(Y, Y, VectorMultiply(X, X))), &Scratch.DistSquared[i]);
+	}
+
+	// Non-negative floats order the same as their bit patterns, the index in the low half breaks ties by input order
+	Scratch.Keys.SetNumUninitialized(Num, EAllowShrinking::No);
+	for(int32 i = 0; i < Num; i++)
+	{
+		Scratch.Keys[i] = (static_cast<uint64>(FMath::AsUInt(Scratch.DistSquared[i])) << 32) | static_cast<uint32>(i);
+	}
+
+	uint64* Keys = Scratch.Keys.GetData();
+	if(K < Num)
+	{
+		std::nth_element(Keys, Keys + K - 1, Keys + Num);
+	}
+	Algo::Sort(MakeArrayView(Keys, K));
+
+	OutIndices.SetNumUninitialized(K);
+	for(int32 i = 0; i < K; i++)
+	{
+		OutIndices[i] = static_cast<int32>(Keys[i] & 0xFFFFFFFFull);
 	}
 }
 
 bool UAuraAbilitySystemLibrary::IsNotFriend(const AActor* FirstActor, const AActor* SecondActor)
 {
-	const bool bBothArePlayers = FirstActor->ActorHasTag(FName("Player")) && SecondActor->ActorHasTag(FName("Player"));
-	const bool bBothAreEnemies = FirstActor->ActorHasTag(FName("Enemy")) && SecondActor->ActorHasTag(FName("Enemy"));
-	const bool bFriends = bBothArePlayers || bBothAreEnemies;
-	return !bFriends;
+	return (ICombatInterface::GetFactionMaskOf(FirstActor) & ICombatInterface::GetFactionMaskOf(SecondActor)) == 0;
 }
 
 FGameplayEffectContextHandle UAuraAbilitySystemLibrary::ApplyDamageEffect(const FDamageEffectParams& DamageEffectParams)
 {
+	SCOPE_CYCLE_COUNTER(STAT_Aura_ApplyDamageEffect);
+	
 	const FAuraGameplayTags GameplayTags = FAuraGameplayTags::Get();
 	const AActor* SourceAvatarActor = DamageEffectParams.SourceAbilitySystemComponent->GetAvatarActor();
 	
@@ -409,6 +484,71 @@ FGameplayEffectContextHandle UAuraAbilitySystemLibrary::ApplyDamageEffect(const
 	return EffectContextHandle;
 }
 
+void UAuraAbilitySystemLibrary::ApplyDamageEffectBatch(const FDamageEffectParams& DamageEffectParams, TArrayView<UAbilitySystemComponent*> TargetAbilitySystemComponents)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Aura_ApplyDamageEffectBatch);
+	
+	UAbilitySystemComponent* SourceASC = DamageEffectParams.SourceAbilitySystemComponent;
+	if(SourceASC == nullptr || TargetAbilitySystemComponents.Num() == 0) return;
+	
+	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+	const AActor* SourceAvatarActor = SourceASC->GetAvatarActor();
+	const float AbilityLevel = DamageEffectParams.AbilityLevel;
+
+	FGameplayEffectContextHandle TemplateContextHandle = SourceASC->MakeEffectContext();
+	TemplateContextHandle.AddSourceObject(SourceAvatarActor);
+
+	// Specs and SetByCaller magnitudes are the same for every target, so they are built once per damage type
+	TArray<FGameplayEffectSpecHandle, TInlineAllocator<4>> SpecHandles;
+	TArray<const FAuraDamageGameplayEffect*, TInlineAllocator<4>> DamageEffects;
+	for(const TTuple<FGameplayTag, FAuraDamageGameplayEffect>& Pair : DamageEffectParams.DamageType)
+	{
+		const FGameplayEffectSpecHandle SpecHandle = SourceASC->MakeOutgoingSpec(Pair.Value.DamageEffectClass, AbilityLevel, TemplateContextHandle);
+		if(!SpecHandle.IsValid()) continue;
+
+		FGameplayEffectSpec& Spec = *SpecHandle.Data;
+		Spec.SetSetByCallerMagnitude(Pair.Key, Pair.Value.Damage.GetValueAtLevel(AbilityLevel));
+		Spec.SetSetByCallerMagnitude(GameplayTags.Debuff_Chance, Pair.Value.DebuffChance.GetValueAtLevel(AbilityLevel));
+		Spec.SetSetByCallerMagnitude(GameplayTags.Debuff_Damage, Pair.Value.DebuffDamage.GetValueAtLevel(AbilityLevel));
+		Spec.SetSetByCallerMagnitude(GameplayTags.Debuff_Frequency, Pair.Value.DebuffFrequency.GetValueAtLevel(AbilityLevel));
+		Spec.SetSetByCallerMagnitude(GameplayTags.Debuff_Duration, Pair.Value.DebuffDuration.GetValueAtLevel(AbilityLevel));
+
+		SpecHandles.Add(SpecHandle);
+		DamageEffects.Add(&Pair.Value);
+	}
+	if(SpecHandles.Num() == 0) return;
+
+	for(UAbilitySystemComponent* TargetASC : TargetAbilitySystemComponents)
+	{
+		if(!IsValid(TargetASC)) continue;
+
+		// The damage execution writes blocked/critical/debuff results into the context, so each target needs its own
+		FGameplayEffectContextHandle TargetContextHandle = TemplateContextHandle.Duplicate();
+
+		FVector ToTarget = FVector::ZeroVector;
+		const AActor* TargetAvatarActor = TargetASC->GetAvatarActor();
+		if(SourceAvatarActor && TargetAvatarActor)
+		{
+			FRotator Rotation = (TargetAvatarActor->GetActorLocation() - SourceAvatarActor->GetActorLocation()).Rotation();
+			Rotation.Pitch = 45.f;
+			ToTarget = Rotation.Vector();
+		}
+
+		// Knockback is rolled per target, same as the single target callers do before filling in the force
+		FAuraCombatRollStream KnockBackRolls = UAuraCombatRandomSubsystem::MakeRollStream(SourceASC, SourceAvatarActor, TargetAvatarActor);
+		for(int32 i = 0; i < SpecHandles.Num(); i++)
+		{
+			const bool bKnockBack = KnockBackRolls.RollPercent() < DamageEffects[i]->KnockBackChance.Value;
+			SetDeathImpulse(TargetContextHandle, ToTarget * DamageEffects[i]->DeathImpulseMagnitude.Value);
+			SetKnockBackForce(TargetContextHandle, bKnockBack ? ToTarget * DamageEffects[i]->KnockBackForceMagnitude.Value : FVector::ZeroVector);
+
+			FGameplayEffectSpec& Spec = *SpecHandles[i].Data;
+			Spec.SetContext(TargetContextHandle, true);
+			TargetASC->ApplyGameplayEffectSpecToSelf(Spec);
+		}
+	}
+}
+
 TArray<FRotator> UAuraAbilitySystemLibrary::EvenlySpacedRotators(const FVector& Forward, const FVector& Axis, float Spread, int32 NumRotators)
 {
 	TArray<FRotator> Rotators;
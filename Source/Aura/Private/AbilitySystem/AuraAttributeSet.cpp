@@ -8,53 +8,112 @@
 #include "AuraGameplayTags.h"
 #include "GameplayEffectExtension.h"
 #include "AbilitySystem/AuraAbilitySystemComponent.h"
+#include "AbilitySystem/AuraAbilitySystemGlobals.h"
 #include "AbilitySystem/AuraAbilitySystemLibrary.h"
+#include "Game/AuraClassInfoSubsystem.h"
+#include "Game/Data/LevelUpInfo.h"
 #include "GameFramework/Character.h"
 #include "Interaction/CombatInterface.h"
 #include "Interaction/PlayerInterface.h"
-#include "GameplayEffectComponents/TargetTagsGameplayEffectComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Player/AuraPlayerController.h"
+#include "TimerManager.h"
+#include "Aura/AuraStats.h"
+
+static TAutoConsoleVariable<int32> CVarAuraAttributeReplicationTiers(
+	TEXT("Aura.Net.AttributeReplicationTiers"),
+	1,
+	TEXT("1: only vital attributes replicate to everyone, the rest go to the owner. 0: every attribute replicates to everyone. Read when attribute sets are created."),
+	ECVF_Default);
 
 UAuraAttributeSet::UAuraAttributeSet()
 {
 	//const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
 
 	//TagsToAttributes.Add(GameplayTags.Attributes_Primary_Intelligence, GetStrengthAttribute);
-	
+
+	// Templates never replicate, only live instances need the condition
+	if(!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		SetDetailAttributesReplicateToAll(CVarAuraAttributeReplicationTiers.GetValueOnAnyThread() == 0);
+	}
 }
 
 void UAuraAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
+	// Push model, attributes are marked dirty from PostAttributeChange
+	FDoRepLifetimeParams VitalParams;
+	VitalParams.RepNotifyCondition = REPNOTIFY_Always;
+	VitalParams.bIsPushBased = true;
+
+	// Owner only by default, see SetDetailAttributesReplicateToAll
+	FDoRepLifetimeParams DetailParams = VitalParams;
+	DetailParams.Condition = COND_Dynamic;
+
 	//Primary Notifies
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Strength, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Intelligence, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Resilience, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Vigor, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Strength, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Intelligence, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Resilience, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Vigor, DetailParams);
 	
 	//Secondary Notifies
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Armor, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, ArmorPenetration, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, BlockChance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, CriticalHitChance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, CriticalHitDamage, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, CriticalHitResistance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, HealthRegeneration, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, ManaRegeneration, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, MaxHealth, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, MaxMana, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Armor, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, ArmorPenetration, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, BlockChance, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, CriticalHitChance, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, CriticalHitDamage, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, CriticalHitResistance, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, HealthRegeneration, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, ManaRegeneration, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, MaxHealth, VitalParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, MaxMana, VitalParams);
 
 	// Resistance Notifies
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, FireResistance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, LightningResistance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, ArcaneResistance, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, PhysicalResistance, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, FireResistance, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, LightningResistance, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, ArcaneResistance, DetailParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, PhysicalResistance, DetailParams);
 
 	//Vital Notifies
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Health, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UAuraAttributeSet, Mana, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Health, VitalParams);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UAuraAttributeSet, Mana, VitalParams);
+}
+
+void UAuraAttributeSet::SetDetailAttributesReplicateToAll(bool bReplicateToAll)
+{
+	const ELifetimeCondition Condition = bReplicateToAll ? COND_None : COND_OwnerOnly;
+
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, Strength, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, Intelligence, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, Resilience, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, Vigor, Condition);
+
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, Armor, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, ArmorPenetration, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, BlockChance, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, CriticalHitChance, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, CriticalHitDamage, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, CriticalHitResistance, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, HealthRegeneration, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, ManaRegeneration, Condition);
+
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, FireResistance, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, LightningResistance, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, ArcaneResistance, Condition);
+	DOREPDYNAMICCONDITION_SETCONDITION_FAST(UAuraAttributeSet, PhysicalResistance, Condition);
+}
+
+void UAuraAttributeSet::MarkAttributeDirty(const FGameplayAttribute& Attribute)
+{
+	// Meta attributes (IncomingDamage, IncomingXP) don't replicate
+	FProperty* Property = Attribute.GetUProperty();
+	if(Property && Property->HasAnyPropertyFlags(CPF_Net))
+	{
+		MARK_PROPERTY_DIRTY(this, Property);
+	}
 }
 
 void UAuraAttributeSet::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
@@ -135,6 +194,8 @@ void UAuraAttributeSet::PostAttributeChange(const FGameplayAttribute& Attribute,
 {
 	Super::PostAttributeChange(Attribute, OldValue, NewValue);
 
+	MarkAttributeDirty(Attribute);
+
 	if(Attribute == GetMaxHealthAttribute() && bTopOffHealth)
 	{
 		SetHealth(GetMaxHealth());
@@ -334,171 +395,141 @@ void UAuraAttributeSet::HandleIncomingDamage(const FEffectProperties& EffectProp
 		// LifeSiphon 
 		if (EffectProperties.SourceASC && EffectProperties.SourceASC->HasMatchingGameplayTag(GameplayTags.Abilities_Passive_LifeSiphon))
 		{
-			Siphon("Life", LocalInComingDamage, EffectProperties);
+			Siphon(EAuraSiphonType::Life, LocalInComingDamage, EffectProperties);
 		}
 
 		// ManaSiphon 
 		if (EffectProperties.SourceASC && EffectProperties.SourceASC->HasMatchingGameplayTag(GameplayTags.Abilities_Passive_ManaSiphon))
 		{
-			Siphon("Mana", LocalInComingDamage, EffectProperties);
+			Siphon(EAuraSiphonType::Mana, LocalInComingDamage, EffectProperties);
 		}
 	}
 }
 
 void UAuraAttributeSet::HandleIncomingXP(const FEffectProperties& EffectProperties)
 {
-	const float LocalIncomingXP = GetIncomingXP();
+	const int32 LocalIncomingXP = static_cast<int32>(GetIncomingXP());
 	SetIncomingXP(0.f);
 		
-	// source character is the owner, since GA_ListenForEvents applies GE_EventBasedEffect, adding to IncomingXP
-	if(EffectProperties.SourceCharacter->Implements<UPlayerInterface>() && EffectProperties.SourceCharacter->Implements<UCombatInterface>())
+	// source character is the owner, since GA_ListenForEvents applies GE_EventBasedEffect, adding to IncomingXP.
+	// Kills landing in the same frame are awarded together on the next tick.
+	if(PendingXPRewards.Num() == 0)
 	{
-		const int32 CurrentLevel = ICombatInterface::Execute_GetPlayerLevel(EffectProperties.SourceCharacter);
-		const int32 CurrentXP = IPlayerInterface::Execute_GetXP(EffectProperties.SourceCharacter);
+		GetWorld()->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UAuraAttributeSet::FlushPendingXP));
+	}
+	PendingXPRewards.Add(LocalIncomingXP);
+}
 
-		const int32 NewLevel = IPlayerInterface::Execute_FindLevelForXP(EffectProperties.SourceCharacter, CurrentXP + LocalIncomingXP);
-		const int32 NumLevelUps = NewLevel - CurrentLevel;
-		if(NumLevelUps > 0)
-		{
-			
-			IPlayerInterface::Execute_AddToPlayerLevel(EffectProperties.SourceCharacter, NumLevelUps);
+void UAuraAttributeSet::FlushPendingXP()
+{
+	const TArray<int32> XPRewards = MoveTemp(PendingXPRewards);
+	PendingXPRewards.Reset();
+	AwardXP(XPRewards);
+}
 
-			int32 AttributePointsReward = 0;
-			int32 SpellPointsReward = 0;
+void UAuraAttributeSet::AwardXP(TArrayView<const int32> XPRewards)
+{
+	const UAbilitySystemComponent* OwningASC = GetOwningAbilitySystemComponent();
+	AActor* PlayerActor = OwningASC ? OwningASC->GetAvatarActor() : nullptr;
+	if(PlayerActor == nullptr || !PlayerActor->Implements<UPlayerInterface>() || !PlayerActor->Implements<UCombatInterface>()) return;
 
-			for (int32 i = 0; i < NumLevelUps; ++i)
-			{
-				SpellPointsReward += IPlayerInterface::Execute_GetSpellPointsReward(EffectProperties.SourceCharacter, CurrentLevel + i);
-				AttributePointsReward += IPlayerInterface::Execute_GetAttributePointsReward(EffectProperties.SourceCharacter, CurrentLevel + i);
-			}
-			
-			IPlayerInterface::Execute_AddToAttributePoints(EffectProperties.SourceCharacter, AttributePointsReward);
-			IPlayerInterface::Execute_AddToSpellPoints(EffectProperties.SourceCharacter, SpellPointsReward);
+	int32 TotalIncomingXP = 0;
+	for(const int32 XPReward : XPRewards)
+	{
+		TotalIncomingXP += XPReward;
+	}
 
-			bTopOffHealth = true;
-			bTopOffMana = true;
-				
-			IPlayerInterface::Execute_LevelUp(EffectProperties.SourceCharacter);
+	const int32 CurrentLevel = ICombatInterface::Execute_GetPlayerLevel(PlayerActor);
+	const int32 CurrentXP = IPlayerInterface::Execute_GetXP(PlayerActor);
+
+	FAuraLevelUpRewards Rewards;
+	const IPlayerInterface* PlayerInterface = Cast<IPlayerInterface>(PlayerActor);
+	if(const ULevelUpInfo* LevelUpInfo = PlayerInterface ? PlayerInterface->GetLevelUpInfo() : nullptr)
+	{
+		Rewards = LevelUpInfo->GetLevelUpRewards(CurrentLevel, CurrentXP + TotalIncomingXP);
+	}
+	else
+	{
+		// Blueprint implementers only expose the per-level events
+		Rewards.NewLevel = IPlayerInterface::Execute_FindLevelForXP(PlayerActor, CurrentXP + TotalIncomingXP);
+		Rewards.NumLevelUps = Rewards.NewLevel - CurrentLevel;
+		for (int32 i = 0; i < Rewards.NumLevelUps; ++i)
+		{
+			Rewards.SpellPoints += IPlayerInterface::Execute_GetSpellPointsReward(PlayerActor, CurrentLevel + i);
+			Rewards.AttributePoints += IPlayerInterface::Execute_GetAttributePointsReward(PlayerActor, CurrentLevel + i);
 		}
+	}
+
+	if(Rewards.NumLevelUps > 0)
+	{
+		IPlayerInterface::Execute_AddToPlayerLevel(PlayerActor, Rewards.NumLevelUps);
+		IPlayerInterface::Execute_AddToAttributePoints(PlayerActor, Rewards.AttributePoints);
+		IPlayerInterface::Execute_AddToSpellPoints(PlayerActor, Rewards.SpellPoints);
+
+		bTopOffHealth = true;
+		bTopOffMana = true;
 			
-		IPlayerInterface::Execute_AddToXP(EffectProperties.SourceCharacter, LocalIncomingXP);
+		IPlayerInterface::Execute_LevelUp(PlayerActor);
 	}
+		
+	IPlayerInterface::Execute_AddToXP(PlayerActor, TotalIncomingXP);
 }
 
 void UAuraAttributeSet::Debuff(const FEffectProperties& EffectProperties)
 {
 	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
-	FGameplayEffectContextHandle EffectContextHandle = EffectProperties.SourceASC->MakeEffectContext();
-	EffectContextHandle.AddSourceObject(EffectProperties.SourceAvatarActor);
-
 	const FGameplayTag DamageType = UAuraAbilitySystemLibrary::GetDamageType(EffectProperties.EffectContextHandle);
-	const FScalableFloat DebuffDamage = UAuraAbilitySystemLibrary::GetDebuffDamage(EffectProperties.EffectContextHandle);
-	const FScalableFloat DebuffDuration = UAuraAbilitySystemLibrary::GetDebuffDuration(EffectProperties.EffectContextHandle);
-	const FScalableFloat DebuffFrequency = UAuraAbilitySystemLibrary::GetDebuffFrequency(EffectProperties.EffectContextHandle);
-
-	FString DebuffName = FString::Printf(TEXT("DynamicDebuff_%s"), *DamageType.ToString());
-	UGameplayEffect* GameplayEffect = NewObject<UGameplayEffect>(GetTransientPackage(), FName(DebuffName));
-
-	GameplayEffect->DurationPolicy = EGameplayEffectDurationType::HasDuration;
-	GameplayEffect->Period = DebuffFrequency;
-	GameplayEffect->DurationMagnitude = DebuffDuration;
-
-	FGameplayTagContainer GrantedTags = GameplayEffect->GetGrantedTags();
-	const FGameplayTag& DebuffTag = GameplayTags.DamageTypesToDebuffs[DamageType];
+	const int32 DamageTypeIndex = GameplayTags.GetDamageTypeIndex(DamageType);
+	if(DamageTypeIndex == INDEX_NONE) return;
 
-	FInheritedTagContainer TagContainer = FInheritedTagContainer();
-	UTargetTagsGameplayEffectComponent& AssetTagsComponent = GameplayEffect->FindOrAddComponent<UTargetTagsGameplayEffectComponent>();
-	
-	TagContainer.Added.AddTag(DebuffTag);
-	TagContainer.CombinedTags.AddTag(DebuffTag);
-	
-	GrantedTags.AddTag(DebuffTag);
-	if (DebuffTag.MatchesTagExact(GameplayTags.Debuff_Stun))
-	{
-		TagContainer.Added.AddTag(GameplayTags.Player_Block_CursorTrace);
-		TagContainer.Added.AddTag(GameplayTags.Player_Block_InputPressed);
-		TagContainer.Added.AddTag(GameplayTags.Player_Block_InputHeld);
-		TagContainer.Added.AddTag(GameplayTags.Player_Block_InputReleased);
-	}
+	// One shared effect per damage type, this hit's values go on the spec
+	const UGameplayEffect* DebuffEffect = UAuraAbilitySystemGlobals::Get().GetDebuffEffect(static_cast<EAuraDamageType>(DamageTypeIndex));
+	if(DebuffEffect == nullptr) return;
 	
-	AssetTagsComponent.SetAndApplyTargetTagChanges(TagContainer);
+	FGameplayEffectContextHandle EffectContextHandle = EffectProperties.SourceASC->MakeEffectContext();
+	EffectContextHandle.AddSourceObject(EffectProperties.SourceAvatarActor);
+	UAuraAbilitySystemLibrary::SetDamageType(EffectContextHandle, DamageType);
 
-	GameplayEffect->StackingType = EGameplayEffectStackingType::AggregateBySource;
-	GameplayEffect->StackLimitCount = 1;
+	const float DebuffDamage = UAuraAbilitySystemLibrary::GetDebuffDamage(EffectProperties.EffectContextHandle);
+	const float DebuffDuration = UAuraAbilitySystemLibrary::GetDebuffDuration(EffectProperties.EffectContextHandle);
+	const float DebuffFrequency = UAuraAbilitySystemLibrary::GetDebuffFrequency(EffectProperties.EffectContextHandle);
 
-	const int32 ModIndex = GameplayEffect->Modifiers.Num();
-	GameplayEffect->Modifiers.Add(FGameplayModifierInfo());
-	FGameplayModifierInfo& ModifierInfo = GameplayEffect->Modifiers[ModIndex];
+	FGameplayEffectSpec DebuffSpec(DebuffEffect, EffectContextHandle, 1.f);
+	DebuffSpec.SetSetByCallerMagnitude(GameplayTags.Debuff_Damage, DebuffDamage);
+	DebuffSpec.SetSetByCallerMagnitude(GameplayTags.Debuff_Duration, DebuffDuration);
+	DebuffSpec.Period = DebuffFrequency;
 	
-	ModifierInfo.ModifierMagnitude = DebuffDamage;
-	ModifierInfo.ModifierOp = EGameplayModOp::Additive;
-	ModifierInfo.Attribute = UAuraAttributeSet::GetIncomingDamageAttribute();
-
-	if(FGameplayEffectSpec* MutableSpec = new FGameplayEffectSpec(GameplayEffect, EffectContextHandle, 1))
-	{
-		FAuraGameplayEffectContext* AuraContext = static_cast<FAuraGameplayEffectContext*>(MutableSpec->GetContext().Get());
-		TSharedPtr<FGameplayTag> DebuffDamageType = MakeShareable(new FGameplayTag(DamageType));
-		AuraContext->SetDamageType(DebuffDamageType);
-		
-		EffectProperties.TargetASC->ApplyGameplayEffectSpecToSelf(*MutableSpec);
-	}
+	EffectProperties.TargetASC->ApplyGameplayEffectSpecToSelf(DebuffSpec);
+	INC_DWORD_STAT(STAT_Aura_DebuffsApplied);
 }
 
-void UAuraAttributeSet::Siphon(const FString& Attribute, float Damage, const FEffectProperties& Props)
+void UAuraAttributeSet::Siphon(EAuraSiphonType SiphonType, float Damage, const FEffectProperties& Props)
 {
-    if (Props.SourceCharacter->Implements<UCombatInterface>() &&
-        ICombatInterface::Execute_IsDead(Props.SourceCharacter))
-        return;
-
-    const FString SiphonName = FString::Printf(TEXT("%sSiphon"), *Attribute);
-    UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), FName(SiphonName));
-
-    const FGameplayTag SiphonTag = FGameplayTag::RequestGameplayTag(
-        FName(FString::Printf(TEXT("Abilities.Passive.%s"), *SiphonName)));
-
-    UAuraAbilitySystemComponent* SourceASC = Cast<UAuraAbilitySystemComponent>(Props.SourceASC);
-    const UCharacterClassInfo* CharacterClassInfo = UAuraAbilitySystemLibrary::GetCharacterClassInfo(
-        Props.SourceCharacter);
-    const FGameplayAbilitySpec* Spec = SourceASC->GetSpecFromAbilityTag(SiphonTag);
+	if (Props.SourceCharacter->Implements<UCombatInterface>() &&
+		ICombatInterface::Execute_IsDead(Props.SourceCharacter))
+		return;
 
-    if (!SourceASC || !SourceASC->HasMatchingGameplayTag(SiphonTag) || !CharacterClassInfo || !Spec ||
-        !CharacterClassInfo->PassiveAbilityCoefficients) { return; }
-
-    if (const FRealCurve* SiphonCurve = CharacterClassInfo->PassiveAbilityCoefficients->FindCurve(
-        FName(FString::Printf(TEXT("%sPercentage"), *SiphonName)), FString()))
-    {
-        const float AbilityLevel = Spec->Level;
-        const float SiphonPercent = SiphonCurve->Eval(AbilityLevel);
-        Damage *= SiphonPercent / 100.f;
-    }
-
-    Effect->DurationPolicy = EGameplayEffectDurationType::Instant;
-    Effect->StackingType = EGameplayEffectStackingType::AggregateBySource;
-    Effect->StackLimitCount = 1;
+	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+	const bool bLifeSiphon = SiphonType == EAuraSiphonType::Life;
+	const FGameplayTag& SiphonTag = bLifeSiphon ? GameplayTags.Abilities_Passive_LifeSiphon : GameplayTags.Abilities_Passive_ManaSiphon;
 
-    const int32 Index = Effect->Modifiers.Num();
-    Effect->Modifiers.Add(FGameplayModifierInfo());
-    FGameplayModifierInfo& ModifierInfo = Effect->Modifiers[Index];
+	UAuraAbilitySystemComponent* SourceASC = Cast<UAuraAbilitySystemComponent>(Props.SourceASC);
+	const UCharacterClassInfo* CharacterClassInfo = UAuraClassInfoSubsystem::GetCharacterClassInfo(Props.SourceCharacter);
+	const UGameplayEffect* SiphonEffect = UAuraAbilitySystemGlobals::Get().GetSiphonEffect(SiphonType);
+	if (!SourceASC || !SourceASC->HasMatchingGameplayTag(SiphonTag) || !CharacterClassInfo || !SiphonEffect) { return; }
 
-    ModifierInfo.ModifierMagnitude = FScalableFloat(Damage);
-    ModifierInfo.ModifierOp = EGameplayModOp::Additive;
+	const int32 SiphonLevel = SourceASC->GetPassiveAbilityLevel(SiphonTag);
+	if (SiphonLevel <= 0) { return; }
 
-	// check is for life or mana siphon
-	if (Attribute == "Life")
-	{
-		ModifierInfo.Attribute = GetHealthAttribute();
-	}
-	else
-	{
-		ModifierInfo.Attribute = GetManaAttribute();
-	}
+	const EAuraCoefficient Coefficient = bLifeSiphon ? EAuraCoefficient::LifeSiphonPercentage : EAuraCoefficient::ManaSiphonPercentage;
+	// Without a percentage row the whole damage is siphoned
+	const float SiphonPercent = CharacterClassInfo->GetCoefficient(Coefficient, SiphonLevel, 100.f);
 
-    FGameplayEffectContextHandle EffectContext = Props.SourceASC->MakeEffectContext();
-    EffectContext.AddSourceObject(Props.SourceAvatarActor);
+	FGameplayEffectContextHandle EffectContext = Props.SourceASC->MakeEffectContext();
+	EffectContext.AddSourceObject(Props.SourceAvatarActor);
 
-    if (FGameplayEffectSpec* MutableSpec = new FGameplayEffectSpec(Effect, EffectContext, 1.f))
-    {
-        Props.SourceASC->ApplyGameplayEffectSpecToSelf(*MutableSpec);
-    }
+	FGameplayEffectSpec SiphonSpec(SiphonEffect, EffectContext, 1.f);
+	SiphonSpec.SetSetByCallerMagnitude(SiphonTag, Damage * SiphonPercent / 100.f);
+	Props.SourceASC->ApplyGameplayEffectSpecToSelf(SiphonSpec);
 }
 
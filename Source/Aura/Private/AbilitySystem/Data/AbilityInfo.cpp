@@ -7,12 +7,14 @@
 
 FAuraAbilityInfo UAbilityInfo::FindAbilityInfoForTag(const FGameplayTag& AbilityTag, bool bLogNotFound) const
 {
-	for (const FAuraAbilityInfo& AbilityInfo : AbilityInformation)
+	return GetAbilityInfoForTag(AbilityTag, bLogNotFound);
+}
+
+const FAuraAbilityInfo& UAbilityInfo::GetAbilityInfoForTag(const FGameplayTag& AbilityTag, bool bLogNotFound) const
+{
+	if(const FAuraAbilityInfo* AbilityInfo = AbilityIndex.Find(AbilityInformation, AbilityTag))
 	{
-		if (AbilityInfo.AbilityTag == AbilityTag)
-		{
-			return AbilityInfo;
-		}
+		return *AbilityInfo;
 	}
 
 	if(bLogNotFound)
@@ -20,5 +22,22 @@ FAuraAbilityInfo UAbilityInfo::FindAbilityInfoForTag(const FGameplayTag& Ability
 		UE_LOG(LogAura, Error, TEXT("Can't find info for AbilityTag [%s] on AbilityInfo [%s]"), *AbilityTag.ToString(), *GetNameSafe(this));
 	}
 
-	return FAuraAbilityInfo();
-}
\ No newline at end of file
+	static const FAuraAbilityInfo EmptyInfo;
+	return EmptyInfo;
+}
+
+void UAbilityInfo::PostLoad()
+{
+	Super::PostLoad();
+
+	AbilityIndex.Build(AbilityInformation, &FAuraAbilityInfo::AbilityTag);
+}
+
+#if WITH_EDITOR
+void UAbilityInfo::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	AbilityIndex.Build(AbilityInformation, &FAuraAbilityInfo::AbilityTag);
+}
+#endif
@@ -7,18 +7,33 @@
 
 FAuraAttributeInfo UAttributeInfo::FindAttributeInfoForTag(const FGameplayTag& AttributeTag, bool bLogNotFound) const
 {
-	for(const FAuraAttributeInfo& Info : AttributeInformation)
-	{
-		if(Info.AttributeTag.MatchesTagExact(AttributeTag))
-		{
-			return Info;
-		}
-	}
+	const FAuraAttributeInfo* Info = GetAttributeInfoForTag(AttributeTag, bLogNotFound);
+	return Info ? *Info : FAuraAttributeInfo();
+}
 
-	if(bLogNotFound)
+const FAuraAttributeInfo* UAttributeInfo::GetAttributeInfoForTag(const FGameplayTag& AttributeTag, bool bLogNotFound) const
+{
+	const FAuraAttributeInfo* Info = AttributeIndex.Find(AttributeInformation, AttributeTag);
+	if(Info == nullptr && bLogNotFound)
 	{
 		UE_LOG(LogAura, Warning, TEXT("Can't find info for AttributeTag [%s] on AttributeInfo [%s]."), *AttributeTag.ToString(), *GetNameSafe(this));
 	}
 
-	return FAuraAttributeInfo();
+	return Info;
+}
+
+void UAttributeInfo::PostLoad()
+{
+	Super::PostLoad();
+
+	AttributeIndex.Build(AttributeInformation, &FAuraAttributeInfo::AttributeTag);
+}
+
+#if WITH_EDITOR
+void UAttributeInfo::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	AttributeIndex.Build(AttributeInformation, &FAuraAttributeInfo::AttributeTag);
 }
+#endif
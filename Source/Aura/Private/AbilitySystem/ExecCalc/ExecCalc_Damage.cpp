@@ -6,8 +6,11 @@
 #include "AbilitySystemComponent.h"
 #include "AuraAbilityTypes.h"
 #include "AuraGameplayTags.h"
+#include "AbilitySystem/AuraAbilitySystemComponent.h"
 #include "AbilitySystem/AuraAbilitySystemLibrary.h"
 #include "AbilitySystem/AuraAttributeSet.h"
+#include "Game/AuraClassInfoSubsystem.h"
+#include "Game/AuraCombatRandomSubsystem.h"
 #include "Game/Data/CharacterClassInfo.h"
 #include "Interaction/CombatInterface.h"
 
@@ -47,6 +50,40 @@ static const AuraDamageStatics& DamageStatics()
 	return DStatics;
 }
 
+struct FAuraDamageTypeEntry
+{
+	FGameplayTag DamageType;
+	FGameplayEffectAttributeCaptureDefinition ResistanceDef;
+	FGameplayTag DebuffType;
+};
+
+using FAuraDamageTypeTable = TStaticArray<FAuraDamageTypeEntry, static_cast<uint8>(EAuraDamageType::MAX)>;
+
+// Built on the first damage execution, after the native tags are registered
+static const FAuraDamageTypeTable& DamageTypeTable()
+{
+	static const FAuraDamageTypeTable Table = []()
+	{
+		const FAuraGameplayTags& Tags = FAuraGameplayTags::Get();
+		const FGameplayEffectAttributeCaptureDefinition ResistanceDefs[] =
+		{
+			DamageStatics().FireResistanceDef,
+			DamageStatics().LightningResistanceDef,
+			DamageStatics().ArcaneResistanceDef,
+			DamageStatics().PhysicalResistanceDef
+		};
+		static_assert(UE_ARRAY_COUNT(ResistanceDefs) == static_cast<uint8>(EAuraDamageType::MAX), "One resistance per damage type");
+
+		FAuraDamageTypeTable NewTable;
+		for(int32 i = 0; i < NewTable.Num(); i++)
+		{
+			NewTable[i] = { Tags.DamageTypes[i].DamageType, ResistanceDefs[i], Tags.DamageTypes[i].Debuff };
+		}
+		return NewTable;
+	}();
+	return Table;
+}
+
 UExecCalc_Damage::UExecCalc_Damage()
 {
 	RelevantAttributesToCapture.Add(DamageStatics().ArmorDef);
@@ -63,13 +100,15 @@ UExecCalc_Damage::UExecCalc_Damage()
 }
 
 void UExecCalc_Damage::DetermineDebuff(const FGameplayEffectCustomExecutionParameters& ExecutionParams, const FGameplayEffectSpec& Spec,
-	FAggregatorEvaluateParameters EvaluationParameters, TMap<FGameplayTag, FGameplayEffectAttributeCaptureDefinition>& InTagsToDefs) const
+	FAggregatorEvaluateParameters EvaluationParameters, TArrayView<const int32> DebuffRolls) const
 {
 	const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
-	for(TTuple<FGameplayTag, FGameplayTag> Pair : GameplayTags.DamageTypesToDebuffs)
+	const FAuraDamageTypeTable& Table = DamageTypeTable();
+	check(DebuffRolls.Num() >= Table.Num());
+	for(int32 i = 0; i < Table.Num(); i++)
 	{
-		const FGameplayTag DamageType = Pair.Key;
-		const FGameplayTag DebuffType = Pair.Value;
+		const FAuraDamageTypeEntry& Entry = Table[i];
+		const FGameplayTag& DamageType = Entry.DamageType;
 		const float TypeDamage = Spec.GetSetByCallerMagnitude(DamageType, false, -1.f);
 		if(TypeDamage > -.5f) // .5 padding for floating point [im]precision
 		{
@@ -77,11 +116,10 @@ void UExecCalc_Damage::DetermineDebuff(const FGameplayEffectCustomExecutionParam
 			const float SourceDebuffChance = Spec.GetSetByCallerMagnitude(GameplayTags.Debuff_Chance, false, -1.f);
 
 			float TargetDebuffResistance = 0.f;
-			const FGameplayTag& ResistanceTag = GameplayTags.DamageTypesToResistances[DamageType];
-			ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(InTagsToDefs[ResistanceTag], EvaluationParameters, TargetDebuffResistance);
+			ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(Entry.ResistanceDef, EvaluationParameters, TargetDebuffResistance);
 			TargetDebuffResistance = FMath::Max<float>(TargetDebuffResistance, 0.f);
 			const float EffectiveDebuffChance = SourceDebuffChance * (100 - TargetDebuffResistance) / 100.f;
-			const bool bDebuff = FMath::RandRange(1, 100) < EffectiveDebuffChance;
+			const bool bDebuff = DebuffRolls[i] < EffectiveDebuffChance;
 			if(bDebuff)
 			{
 				FGameplayEffectContextHandle ContextHandle = Spec.GetContext();
@@ -105,39 +143,19 @@ float UExecCalc_Damage::ApplyDamageReductionByHaloOfProtection(float Damage, con
 {
 	const FAuraGameplayTags& AbilityTags = FAuraGameplayTags::Get();
 	if (!TargetASC || !TargetASC->HasMatchingGameplayTag(AbilityTags.Abilities_Passive_HaloOfProtection) ||
-		!TargetCharacterClassInfo || !TargetCharacterClassInfo->PassiveAbilityCoefficients)
+		!TargetCharacterClassInfo || !TargetCharacterClassInfo->HasCoefficient(EAuraCoefficient::DamageReductionRatio))
 	{
 		return Damage;
 	}
 
-	const FRealCurve* DamageReductionCurve = TargetCharacterClassInfo->PassiveAbilityCoefficients->FindCurve(FName("DamageReductionRatio"), FString());
-
-	if (DamageReductionCurve)
+	int32 AbilityLevel = 1; // Fallback
+	if (const UAuraAbilitySystemComponent* AuraTargetASC = Cast<UAuraAbilitySystemComponent>(TargetASC))
 	{
-		int32 AbilityLevel = 1; // Fallback
-		if (TargetASC)
-		{
-			const FAuraGameplayTags& Tags = FAuraGameplayTags::Get();
-			int32 MaxFoundLevel = 0;
-
-			for (const FGameplayAbilitySpec& SpecIt : TargetASC->GetActivatableAbilities())
-			{
-				if (SpecIt.Ability && SpecIt.Ability->GetAssetTags().HasTag(Tags.Abilities_Passive_HaloOfProtection))
-				{
-					const int32 SpecLevel = SpecIt.Level;
-					MaxFoundLevel = FMath::Max(MaxFoundLevel, SpecLevel);
-				}
-			}
-
-			if (MaxFoundLevel > 0)
-			{
-				AbilityLevel = MaxFoundLevel;
-			}
-		}
-		
-		const float DamageReductionPercent = DamageReductionCurve->Eval(AbilityLevel);
-		Damage *= 1.f - DamageReductionPercent / 100.f;
+		AbilityLevel = FMath::Max(AbilityLevel, AuraTargetASC->GetPassiveAbilityLevel(AbilityTags.Abilities_Passive_HaloOfProtection));
 	}
+	
+	const float DamageReductionPercent = TargetCharacterClassInfo->GetCoefficient(EAuraCoefficient::DamageReductionRatio, AbilityLevel, 0.f);
+	Damage *= 1.f - DamageReductionPercent / 100.f;
 
 	return Damage;
 }
@@ -145,22 +163,6 @@ float UExecCalc_Damage::ApplyDamageReductionByHaloOfProtection(float Damage, con
 void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
                                               FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
 {
-	TMap<FGameplayTag, FGameplayEffectAttributeCaptureDefinition> TagsToCaptureDefs;
-
-	const FAuraGameplayTags& Tags = FAuraGameplayTags::Get();
-		
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_Armor, DamageStatics().ArmorDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_BlockChance, DamageStatics().BlockChanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_ArmorPenetration, DamageStatics().ArmorPenetrationDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_CriticalHitChance, DamageStatics().CriticalHitChanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_CriticalHitResistance, DamageStatics().CriticalHitResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Secondary_CriticalHitDamage, DamageStatics().CriticalHitDamageDef);
-
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Fire, DamageStatics().FireResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Lightning, DamageStatics().LightningResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Arcane, DamageStatics().ArcaneResistanceDef);
-	TagsToCaptureDefs.Add(Tags.Attributes_Resistance_Physical, DamageStatics().PhysicalResistanceDef);
-	
 	const UAbilitySystemComponent* SourceASC = ExecutionParams.GetSourceAbilitySystemComponent();
 	const UAbilitySystemComponent* TargetASC = ExecutionParams.GetTargetAbilitySystemComponent();
 
@@ -187,23 +189,24 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	EvaluationParameters.SourceTags = SourceTags;
 	EvaluationParameters.TargetTags = TargetTags;
 
+	// Draw every roll of this hit at once: one debuff roll per damage type, then block, then critical hit
+	constexpr int32 NumDamageTypes = static_cast<int32>(EAuraDamageType::MAX);
+	constexpr int32 BlockRoll = NumDamageTypes;
+	constexpr int32 CriticalHitRoll = NumDamageTypes + 1;
+	int32 Rolls[NumDamageTypes + 2];
+	UAuraCombatRandomSubsystem::MakeRollStream(SourceAvatar, SourceAvatar, TargetAvatar, ExecutionParams.GetPredictionKey().Current).RollPercentBatch(Rolls);
+
 	// Debuffs
-	DetermineDebuff(ExecutionParams, Spec, EvaluationParameters, TagsToCaptureDefs);
+	DetermineDebuff(ExecutionParams, Spec, EvaluationParameters, MakeArrayView(Rolls, NumDamageTypes));
 
 	// Get Damage Set by Caller Magnitude
 	float Damage = 0.f;
-	for(const TTuple<FGameplayTag, FGameplayTag>& Pair: FAuraGameplayTags::Get().DamageTypesToResistances)
+	for(const FAuraDamageTypeEntry& Entry : DamageTypeTable())
 	{
-		const FGameplayTag DamageTypeTag = Pair.Key;
-		const FGameplayTag ResistanceTag = Pair.Value;
-		
-		checkf(TagsToCaptureDefs.Contains(ResistanceTag), TEXT("TagsToCapture doesn't contain tag: [%s] in ExecCalc_Damage"), *ResistanceTag.ToString());
-		const FGameplayEffectAttributeCaptureDefinition CaptureDef = TagsToCaptureDefs[ResistanceTag];
-
-		float DamageTypeValue = Spec.GetSetByCallerMagnitude(Pair.Key, false);
+		float DamageTypeValue = Spec.GetSetByCallerMagnitude(Entry.DamageType, false);
 
 		float Resistance = 0.f;
-		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(CaptureDef, EvaluationParameters, Resistance);
+		ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(Entry.ResistanceDef, EvaluationParameters, Resistance);
 		Resistance = FMath::Clamp(Resistance, 0.f, 100.f);
 
 		DamageTypeValue *= (100.f - Resistance) / 100.f;
@@ -215,7 +218,7 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	float TargetBlockChance = 0.f;
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().BlockChanceDef, EvaluationParameters, TargetBlockChance);
 	TargetBlockChance = FMath::Max<float>(TargetBlockChance, 0.f);
-	const bool bBlocked = FMath::RandRange(1, 100) < TargetBlockChance;
+	const bool bBlocked = Rolls[BlockRoll] < TargetBlockChance;
 	
 	FGameplayEffectContextHandle EffectContextHandle = Spec.GetContext();
 	
@@ -232,17 +235,16 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().ArmorPenetrationDef, EvaluationParameters, SourceArmorPenetration);
 	SourceArmorPenetration = FMath::Max<float>(SourceArmorPenetration, 0.f);
 
-	const UCharacterClassInfo* SourceCharacterClassInfo  = UAuraAbilitySystemLibrary::GetCharacterClassInfo(SourceAvatar);
-	const UCharacterClassInfo* TargetCharacterClassInfo = UAuraAbilitySystemLibrary::GetCharacterClassInfo(TargetAvatar);
+	// Source and Target share the game mode's class info, cached per world; its coefficient curves are baked into level-indexed tables.
+	// A missing damage coefficient row reads as 1 so the attribute still applies unscaled.
+	const UCharacterClassInfo* CharacterClassInfo = UAuraClassInfoSubsystem::GetCharacterClassInfo(SourceAvatar);
 	
-	const FRealCurve* ArmorPenetrationCurve = SourceCharacterClassInfo->DamageCalculationCoefficients->FindCurve(FName("ArmorPenetration"), FString());
-	const float ArmorPenetrationCoefficient = ArmorPenetrationCurve->Eval(SourcePlayerLevel);
+	const float ArmorPenetrationCoefficient = CharacterClassInfo->GetCoefficient(EAuraCoefficient::ArmorPenetration, SourcePlayerLevel, 1.f);
 	
 	// ArmorPenetration ignores a percentage of the Target's Armor.	
 	const float EffectiveArmor = TargetArmor * ( 100 - SourceArmorPenetration * ArmorPenetrationCoefficient ) / 100.f;
 
-	const FRealCurve* EffectiveArmorCurve = SourceCharacterClassInfo->DamageCalculationCoefficients->FindCurve(FName("EffectiveArmor"), FString());
-	const float EffectiveArmorCoefficient = EffectiveArmorCurve->Eval(TargetPlayerLevel);
+	const float EffectiveArmorCoefficient = CharacterClassInfo->GetCoefficient(EAuraCoefficient::EffectiveArmor, TargetPlayerLevel, 1.f);
 	
 	// Armor ignores a percentage of incoming Damage.
 	Damage *= ( 100 - EffectiveArmor * EffectiveArmorCoefficient ) / 100.f;
@@ -259,19 +261,18 @@ void UExecCalc_Damage::Execute_Implementation(const FGameplayEffectCustomExecuti
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(DamageStatics().CriticalHitDamageDef, EvaluationParameters, SourceCriticalHitDamage);
 	SourceCriticalHitDamage = FMath::Max<float>(SourceCriticalHitDamage, 0.f);
 
-	const FRealCurve* CriticalHitResistanceCurve = SourceCharacterClassInfo->DamageCalculationCoefficients->FindCurve(FName("CriticalHitResistance"), FString());
-	const float CriticalHitResistanceCoefficient = CriticalHitResistanceCurve->Eval(TargetPlayerLevel);
+	const float CriticalHitResistanceCoefficient = CharacterClassInfo->GetCoefficient(EAuraCoefficient::CriticalHitResistance, TargetPlayerLevel, 1.f);
 	
 	// Critical Hit Resistance reduces Critical Hit Chance by a certain percentage
 	const float EffectiveCriticalHitChance = SourceCriticalHitChance - TargetCriticalHitResistance * CriticalHitResistanceCoefficient;
-	const bool bCriticalHit = FMath::RandRange(1, 100) < EffectiveCriticalHitChance;
+	const bool bCriticalHit = Rolls[CriticalHitRoll] < EffectiveCriticalHitChance;
 	UAuraAbilitySystemLibrary::SetIsCriticalHit(EffectContextHandle, bCriticalHit);
 
 	// Double damage plus a bonus if critical hit
 	Damage = bCriticalHit ? 2.f * Damage + SourceCriticalHitDamage : Damage;
 
 	//Grant a GameplayTag to the owning ASC upon Ability Activation. In the Damage ExecCalc, check the source owned tags for this tag, and if it’s present, decrease effective damage by 20%.
-	Damage = ApplyDamageReductionByHaloOfProtection(Damage, TargetASC, TargetCharacterClassInfo );
+	Damage = ApplyDamageReductionByHaloOfProtection(Damage, TargetASC, CharacterClassInfo);
 
 	//Grant a GameplayTag to the owning ASC upon Ability Activation. In the Attribute Set, while handling incoming damage, check the source of the damage for this tag, and if it’s present, use a dynamic gameplay effect to add to the source’s Health.
 	
@@ -4,6 +4,7 @@
 #include "Actor/AuraEffectActor.h"
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemBlueprintLibrary.h"
+#include "Interaction/CombatInterface.h"
 
 AAuraEffectActor::AAuraEffectActor()
 {
@@ -20,7 +21,7 @@ void AAuraEffectActor::BeginPlay()
 void AAuraEffectActor::ApplyEffectToTarget(AActor* TargetActor, TSubclassOf<UGameplayEffect> GameplayEffectClass)
 {
 	if (!TargetActor) return;
-	if(TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectToEnemies) return;
+	if(!bApplyEffectToEnemies && (ICombatInterface::GetFactionMaskOf(TargetActor) & MakeFactionMask(EAuraFaction::Enemy)) != 0) return;
     
 	if(UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(TargetActor))
 	{
@@ -53,7 +54,7 @@ void AAuraEffectActor::ApplyEffectToTarget(AActor* TargetActor, TSubclassOf<UGam
 void AAuraEffectActor::OnOverlap(AActor* TargetActor)
 {
 	if (!TargetActor) return;
-	if(TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectToEnemies) return;
+	if(!bApplyEffectToEnemies && (ICombatInterface::GetFactionMaskOf(TargetActor) & MakeFactionMask(EAuraFaction::Enemy)) != 0) return;
 	
 	for (const TTuple<TSubclassOf<UGameplayEffect>, FGameplayEffectProtocol> Effect : GameplayEffectList)
 	{
@@ -68,7 +69,7 @@ void AAuraEffectActor::OnOverlap(AActor* TargetActor)
 void AAuraEffectActor::OnEndOverlap(AActor* TargetActor)
 {
 	if (!TargetActor) return;
-	if(TargetActor->ActorHasTag(FName("Enemy")) && !bApplyEffectToEnemies) return;
+	if(!bApplyEffectToEnemies && (ICombatInterface::GetFactionMaskOf(TargetActor) & MakeFactionMask(EAuraFaction::Enemy)) != 0) return;
 	
 	for (const TTuple<TSubclassOf<UGameplayEffect>, FGameplayEffectProtocol> Effect : GameplayEffectList)
 	{
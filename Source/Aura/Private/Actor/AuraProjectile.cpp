@@ -11,17 +11,24 @@
 #include "NiagaraFunctionLibrary.h"
 #include "AbilitySystem/AuraAbilitySystemLibrary.h"
 #include "Aura/Aura.h"
+#include "Aura/AuraStats.h"
 #include "Components/AudioComponent.h"
+#include "Game/AuraCombatRandomSubsystem.h"
+#include "Game/AuraProjectileManager.h"
+#include "Game/AuraProjectilePool.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
 
 AAuraProjectile::AAuraProjectile()
 {
 	PrimaryActorTick.bCanEverTick = false;
 	bReplicates = true;
 
+	// Movement and hits come from UAuraProjectileManager's batched sweeps, the sphere only describes the shape
 	Sphere = CreateDefaultSubobject<USphereComponent>(TEXT("Sphere"));
 	SetRootComponent(Sphere);
 	Sphere->SetCollisionObjectType(ECC_Projectile);
-	Sphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	Sphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	Sphere->SetCollisionResponseToAllChannels(ECR_Ignore);
 	Sphere->SetCollisionResponseToChannel(ECC_WorldDynamic, ECR_Overlap);
 	Sphere->SetCollisionResponseToChannel(ECC_WorldStatic, ECR_Overlap);
@@ -31,16 +38,200 @@ AAuraProjectile::AAuraProjectile()
 	ProjectileMovement->InitialSpeed = 550.f;
 	ProjectileMovement->MaxSpeed = 550.f;
 	ProjectileMovement->ProjectileGravityScale = 0.f;
+	ProjectileMovement->SetAutoActivate(false);
+	ProjectileMovement->PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	HomingTargetSceneComponent = CreateDefaultSubobject<USceneComponent>(TEXT("HomingTarget"));
+	HomingTargetSceneComponent->SetupAttachment(Sphere);
+	HomingTargetSceneComponent->SetUsingAbsoluteLocation(true);
 }
 
 void AAuraProjectile::BeginPlay()
 {
 	Super::BeginPlay();
-	SetLifeSpan(LifeSpan);
-	SetReplicateMovement(true);
-	Sphere->OnComponentBeginOverlap.AddDynamic(this, &AAuraProjectile::OnSphereOverlap);
-	
-	LoopingSoundComponent = UGameplayStatics::SpawnSoundAttached(LoopingSound, GetRootComponent());
+	ActiveNetUpdateFrequency = GetNetUpdateFrequency();
+
+	// Not auto destroyed, the component is stopped and restarted each time the projectile is reused
+	LoopingSoundComponent = UGameplayStatics::SpawnSoundAttached(LoopingSound, GetRootComponent(), NAME_None, FVector(ForceInit),
+		EAttachLocation::KeepRelativeOffset, false, 1.f, 1.f, 0.f, nullptr, nullptr, false);
+
+	if(HasAuthority())
+	{
+		if(bSpawnIntoPool) DeactivateIntoPool();
+		else Launch();
+	}
+	else if(!bPoolActive)
+	{
+		// Replicated to this client while parked in the server's pool
+		SetPoolActive(false);
+	}
+	else if(LaunchState.LaunchCount != 0)
+	{
+		OnRep_LaunchState(FAuraProjectileLaunch());
+	}
+}
+
+void AAuraProjectile::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopSimulation();
+	Super::EndPlay(EndPlayReason);
+}
+
+void AAuraProjectile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME(AAuraProjectile, bPoolActive);
+	DOREPLIFETIME(AAuraProjectile, LaunchState);
+	DOREPLIFETIME(AAuraProjectile, ImpactLocation);
+}
+
+void AAuraProjectile::Launch()
+{
+	const USceneComponent* HomingTarget = ProjectileMovement->bIsHomingProjectile ? ProjectileMovement->HomingTargetComponent.Get() : nullptr;
+	const AGameStateBase* GameState = GetWorld()->GetGameState();
+
+	LaunchState.Location = GetActorLocation();
+	LaunchState.Velocity = GetActorForwardVector() * ProjectileMovement->InitialSpeed;
+	LaunchState.HomingActor = HomingTarget != nullptr && HomingTarget != HomingTargetSceneComponent ? HomingTarget->GetOwner() : nullptr;
+	LaunchState.HomingLocation = HomingTargetSceneComponent->GetComponentLocation();
+	LaunchState.HomingAcceleration = HomingTarget != nullptr ? ProjectileMovement->HomingAccelerationMagnitude : 0.f;
+	LaunchState.ServerTime = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+	LaunchState.LaunchCount++;
+
+	StartSimulation(0.f);
+}
+
+void AAuraProjectile::StartSimulation(float CatchUpTime)
+{
+	UAuraProjectileManager* Manager = UAuraProjectileManager::Get(this);
+	if(Manager == nullptr || CatchUpTime >= LifeSpan) return;
+
+	const USceneComponent* HomingTarget = nullptr;
+	if(LaunchState.HomingAcceleration != 0.f)
+	{
+		if(LaunchState.HomingActor != nullptr)
+		{
+			HomingTarget = LaunchState.HomingActor->GetRootComponent();
+		}
+		else
+		{
+			HomingTargetSceneComponent->SetWorldLocation(LaunchState.HomingLocation);
+			HomingTarget = HomingTargetSceneComponent;
+		}
+	}
+
+	// Late joiners and late launches are extrapolated in a straight line, homing takes over from there
+	const FVector Location = LaunchState.Location + LaunchState.Velocity * CatchUpTime;
+	SetActorLocationAndRotation(Location, LaunchState.Velocity.Rotation());
+	Manager->Add(this, Location, LaunchState.Velocity, HomingTarget, LaunchState.HomingAcceleration, LifeSpan - CatchUpTime);
+}
+
+void AAuraProjectile::StopSimulation()
+{
+	if(SimIndex == INDEX_NONE) return;
+
+	if(UAuraProjectileManager* Manager = UAuraProjectileManager::Get(this))
+	{
+		Manager->Remove(this);
+	}
+}
+
+void AAuraProjectile::OnRep_LaunchState(const FAuraProjectileLaunch& OldLaunchState)
+{
+	if(!HasActorBegunPlay() || !bPoolActive) return;
+
+	// The free list hands back the most recently parked projectile, so a park and relaunch can land in the same update
+	// and bPoolActive never reads false here. ImpactLocation still holds where the previous flight ended.
+	if(OldLaunchState.LaunchCount != 0 && OldLaunchState.LaunchCount != LaunchState.LaunchCount && ParkedLaunchCount != OldLaunchState.LaunchCount)
+	{
+		PlayParkedImpact();
+		SetPoolActive(false);
+		ParkedLaunchCount = OldLaunchState.LaunchCount;
+		SetPoolActive(true);
+	}
+
+	const AGameStateBase* GameState = GetWorld()->GetGameState();
+	const double Now = GameState ? GameState->GetServerWorldTimeSeconds() : GetWorld()->GetTimeSeconds();
+	StopSimulation();
+	StartSimulation(FMath::Max(static_cast<float>(Now - LaunchState.ServerTime), 0.f));
+}
+
+void AAuraProjectile::ActivateFromPool()
+{
+	SetPoolActive(true);
+	Launch();
+	SetNetUpdateFrequency(ActiveNetUpdateFrequency);
+	ForceNetUpdate();
+}
+
+void AAuraProjectile::DeactivateIntoPool()
+{
+	ImpactLocation = GetActorLocation();
+	SetPoolActive(false);
+
+	// Drop everything the last shot set up so a parked projectile holds no references and the next one starts clean
+	const AAuraProjectile* Defaults = GetClass()->GetDefaultObject<AAuraProjectile>();
+	ProjectileMovement->HomingTargetComponent = nullptr;
+	ProjectileMovement->bIsHomingProjectile = Defaults->ProjectileMovement->bIsHomingProjectile;
+	ProjectileMovement->HomingAccelerationMagnitude = Defaults->ProjectileMovement->HomingAccelerationMagnitude;
+	DamageEffectParams = FDamageEffectParams();
+	LaunchState.HomingActor = nullptr;
+	SetOwner(nullptr);
+	SetInstigator(nullptr);
+
+	// Parked projectiles have nothing new to send, only the next activation has to go out promptly
+	SetNetUpdateFrequency(1.f);
+	ForceNetUpdate();
+}
+
+void AAuraProjectile::ReturnToPool()
+{
+	if(!HasAuthority()) return;
+
+	UAuraProjectilePool* Pool = OwningPool.Get();
+	if(Pool == nullptr || !Pool->Release(this))
+	{
+		Destroy();
+	}
+}
+
+void AAuraProjectile::SetPoolActive(bool bActive)
+{
+	bPoolActive = bActive;
+	bHit = !bActive;
+	SetActorHiddenInGame(!bActive);
+	SetActorEnableCollision(bActive);
+
+	if(bActive)
+	{
+		if(LoopingSoundComponent != nullptr) LoopingSoundComponent->Play();
+	}
+	else
+	{
+		ParkedLaunchCount = LaunchState.LaunchCount;
+		StopSimulation();
+		if(LoopingSoundComponent != nullptr) LoopingSoundComponent->Stop();
+	}
+
+	OnPoolActiveChanged(bActive);
+}
+
+void AAuraProjectile::OnRep_PoolActive()
+{
+	// Parking on the server stands in for Destroyed, play the impact where the server stopped the projectile
+	if(!bPoolActive && !bHit && HasActorBegunPlay())
+	{
+		PlayParkedImpact();
+	}
+	SetPoolActive(bPoolActive);
+}
+
+void AAuraProjectile::PlayParkedImpact()
+{
+	StopSimulation();
+	SetActorLocation(ImpactLocation);
+	ApplyImpactEffects();
 }
 
 void AAuraProjectile::ApplyImpactEffects()
@@ -50,7 +241,6 @@ void AAuraProjectile::ApplyImpactEffects()
 	if(LoopingSoundComponent != nullptr)
 	{
 		LoopingSoundComponent->Stop();
-		LoopingSoundComponent->DestroyComponent();
 	}
 	bHit = true;
 }
@@ -63,45 +253,52 @@ void AAuraProjectile::Destroyed()
 		LoopingSoundComponent->DestroyComponent();
 	}
 	if(!bHit && !HasAuthority()) ApplyImpactEffects();
+	INC_DWORD_STAT(STAT_Aura_ProjectilesDestroyed);
 	Super::Destroyed();
 }
 
-void AAuraProjectile::OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-                                      UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+void AAuraProjectile::HandleLifetimeExpired()
+{
+	if(HasAuthority()) ReturnToPool();
+	else StopSimulation();
+}
+
+bool AAuraProjectile::HandleImpact(AActor* OtherActor, const FVector& InImpactLocation)
 {
-	if (DamageEffectParams.SourceAbilitySystemComponent == nullptr) return;
+	if(!HasAuthority()) return false;
+	if (DamageEffectParams.SourceAbilitySystemComponent == nullptr) return false;
 	
 	const AActor* SourceAvatarActor = DamageEffectParams.SourceAbilitySystemComponent->GetAvatarActor();
-	if(SourceAvatarActor == OtherActor) return;
-	if(!UAuraAbilitySystemLibrary::IsNotFriend(SourceAvatarActor, OtherActor)) return;
+	if(SourceAvatarActor == OtherActor) return false;
+	if(!UAuraAbilitySystemLibrary::IsNotFriend(SourceAvatarActor, OtherActor)) return false;
+
+	SetActorLocation(InImpactLocation);
 	if(!bHit) ApplyImpactEffects();
 	
-	if(HasAuthority())
+	if(UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(OtherActor))
 	{
-		if(UAbilitySystemComponent* TargetASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(OtherActor))
+		if(DamageType.IsValid())
 		{
-			if(DamageType.IsValid())
+			const FVector DeathImpulse = GetActorForwardVector() * DamageEffectParams.DamageType[DamageType].DeathImpulseMagnitude.Value;
+			DamageEffectParams.DamageType[DamageType].DeathImpulse = DeathImpulse;
+
+			const int32 KnockBackRoll = UAuraCombatRandomSubsystem::MakeRollStream(this, SourceAvatarActor, OtherActor).RollPercent();
+			const bool bKnockBack = KnockBackRoll < DamageEffectParams.DamageType[DamageType].KnockBackChance.Value;
+			if(bKnockBack)
 			{
-				const FVector DeathImpulse = GetActorForwardVector() * DamageEffectParams.DamageType[DamageType].DeathImpulseMagnitude.Value;
-				DamageEffectParams.DamageType[DamageType].DeathImpulse = DeathImpulse;
-
-				const bool bKnockBack = FMath::RandRange(1, 100) < DamageEffectParams.DamageType[DamageType].KnockBackChance.Value;
-				if(bKnockBack)
-				{
-					FRotator Rotation = GetActorRotation();
-					Rotation.Pitch = 45.f;
-					
-					const FVector KnockBackDirection = Rotation.Vector();
-					const FVector KnockBackForce = KnockBackDirection * DamageEffectParams.DamageType[DamageType].KnockBackForceMagnitude.Value;
-					DamageEffectParams.DamageType[DamageType].KnockBackForce = KnockBackForce;
-				}
+				FRotator Rotation = GetActorRotation();
+				Rotation.Pitch = 45.f;
+				
+				const FVector KnockBackDirection = Rotation.Vector();
+				const FVector KnockBackForce = KnockBackDirection * DamageEffectParams.DamageType[DamageType].KnockBackForceMagnitude.Value;
+				DamageEffectParams.DamageType[DamageType].KnockBackForce = KnockBackForce;
 			}
-			
-			DamageEffectParams.TargetAbilitySystemComponent = TargetASC;
-			UAuraAbilitySystemLibrary::ApplyDamageEffect(DamageEffectParams);
 		}
 		
-		Destroy();
+		DamageEffectParams.TargetAbilitySystemComponent = TargetASC;
+		UAuraAbilitySystemLibrary::ApplyDamageEffect(DamageEffectParams);
 	}
-	else bHit = true;
+	
+	ReturnToPool();
+	return true;
 }
@@ -1,97 +1,247 @@
 ﻿#include "AuraAbilityTypes.h"
 
-bool FAuraGameplayEffectContext::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+#include "AuraGameplayTags.h"
+#include "Aura/AuraStats.h"
+#include "Engine/NetSerialization.h"
+
+#include <atomic>
+
+namespace AuraEffectContextNet
 {
-	uint32 RepBits = 0;
+	enum ERepFlags : uint32
+	{
+		BlockedHit			= 1 << 0,
+		CriticalHit			= 1 << 1,
+		SuccessfulDebuff	= 1 << 2,
+		DebuffDamage		= 1 << 3,
+		DebuffDuration		= 1 << 4,
+		DebuffFrequency		= 1 << 5,
+		DamageType			= 1 << 6,
+		DeathImpulse		= 1 << 7,
+		KnockBackForce		= 1 << 8,
 
-	const bool bBaseSuccess = Super::NetSerialize(Ar, Map, bOutSuccess);
+		NumBits				= 9
+	};
 
-	if (Ar.IsSaving())
+	// Largest debuff value the wire carries, 1000000
+	static constexpr uint32 MaxTenths = 10000000;
+
+	// Debuff values are non-negative and only need 0.1 precision, sent as a variable length count of tenths.
+	// Anything above zero but below one tenth goes as one tenth, so a small debuff isn't dropped.
+	static void SerializeTenths(FArchive& Ar, float& Value)
 	{
-		if (bIsBlockedHit)
-		{
-			RepBits |= 1 << 0;
-		}
-		if (bIsCriticalHit)
+		uint32 Tenths = 0;
+		if(Ar.IsSaving())
 		{
-			RepBits |= 1 << 1;
+			ensureAlwaysMsgf(Value >= 0.f && Value <= MaxTenths / 10.f, TEXT("Debuff value %f is outside the 0 to %u range the effect context sends, it is clamped"), Value, MaxTenths / 10);
+			Tenths = Value > 0.f ? FMath::Clamp(static_cast<uint32>(FMath::RoundToInt(FMath::Min(Value, MaxTenths / 10.f) * 10.f)), 1u, MaxTenths) : 0;
 		}
-		if(bIsSuccessfulDebuff)
+		Ar.SerializeIntPacked(Tenths);
+		if(Ar.IsLoading())
 		{
-			RepBits |= 1 << 2;
+			Value = static_cast<float>(Tenths) / 10.f;
 		}
-		if(DebuffDamage.Value > 0.f)
-		{
-			RepBits |= 1 << 3;
-		}
-		if(DebuffDuration.Value > 0.f)
+	}
+
+	static void SerializeQuantizedVector(FArchive& Ar, UPackageMap* Map, FVector& Vector, bool& bOutSuccess)
+	{
+		FVector_NetQuantize10 Quantized(Vector);
+		bool bVectorSuccess = true;
+		Quantized.NetSerialize(Ar, Map, bVectorSuccess);
+		bOutSuccess &= bVectorSuccess;
+		if(Ar.IsLoading())
 		{
-			RepBits |= 1 << 4;
+			Vector = Quantized;
 		}
-		if(DebuffFrequency.Value > 0.f)
+	}
+
+	// Damage types from the native table go as an index, anything else falls back to the full tag
+	static void SerializeDamageType(FArchive& Ar, UPackageMap* Map, FGameplayTag& DamageType, bool& bOutSuccess)
+	{
+		const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+		constexpr uint32 FullTagIndex = static_cast<uint32>(EAuraDamageType::MAX);
+
+		uint32 Index = FullTagIndex;
+		if(Ar.IsSaving())
 		{
-			RepBits |= 1 << 5;
+			const int32 TableIndex = GameplayTags.GetDamageTypeIndex(DamageType);
+			Index = TableIndex != INDEX_NONE ? static_cast<uint32>(TableIndex) : FullTagIndex;
 		}
-		if(DamageType.IsValid())
+		Ar.SerializeInt(Index, FullTagIndex + 1);
+
+		if(Ar.IsLoading() && Index < FullTagIndex)
 		{
-			RepBits |= 1 << 6;
+			DamageType = GameplayTags.DamageTypes[Index].DamageType;
+			return;
 		}
-		if(!DeathImpulse.IsZero())
+
+		if(Index == FullTagIndex)
 		{
-			RepBits |= 1 << 7;
+			bool bTagSuccess = true;
+			DamageType.NetSerialize(Ar, Map, bTagSuccess);
+			bOutSuccess &= bTagSuccess;
 		}
-		if(!KnockBackForce.IsZero())
+	}
+}
+
+namespace AuraEffectContextPool
+{
+	// Enough for the contexts alive at once in a large fight, a thread never keeps more than this
+	static constexpr int32 MaxFreeBlocksPerThread = 256;
+
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	struct FThreadFreeList
+	{
+		FFreeBlock* Head = nullptr;
+		int32 Num = 0;
+
+		~FThreadFreeList()
 		{
-			RepBits |= 1 << 8;
+			while(Head)
+			{
+				FFreeBlock* Block = Head;
+				Head = Block->Next;
+				FMemory::Free(Block);
+			}
 		}
+	};
+
+	static thread_local FThreadFreeList FreeList;
+	static std::atomic<uint64> NumPoolMisses = 0;
+}
+
+void* FAuraGameplayEffectContext::operator new(size_t Size)
+{
+	using namespace AuraEffectContextPool;
+
+	// Derived structs have a different size, they skip the pool
+	if(Size == sizeof(FAuraGameplayEffectContext) && FreeList.Head)
+	{
+		FFreeBlock* Block = FreeList.Head;
+		FreeList.Head = Block->Next;
+		FreeList.Num--;
+		INC_DWORD_STAT(STAT_Aura_EffectContextPoolHits);
+		return Block;
 	}
-	
-	if (Ar.IsLoading())
+
+	NumPoolMisses.fetch_add(1, std::memory_order_relaxed);
+	INC_DWORD_STAT(STAT_Aura_EffectContextPoolMisses);
+	return FMemory::Malloc(Size, alignof(FAuraGameplayEffectContext));
+}
+
+void FAuraGameplayEffectContext::operator delete(void* Ptr, size_t Size)
+{
+	using namespace AuraEffectContextPool;
+
+	if(Ptr == nullptr) return;
+
+	if(Size == sizeof(FAuraGameplayEffectContext) && FreeList.Num < MaxFreeBlocksPerThread)
+	{
+		FFreeBlock* Block = static_cast<FFreeBlock*>(Ptr);
+		Block->Next = FreeList.Head;
+		FreeList.Head = Block;
+		FreeList.Num++;
+		return;
+	}
+
+	FMemory::Free(Ptr);
+}
+
+uint64 FAuraGameplayEffectContext::GetNumPoolMisses()
+{
+	return AuraEffectContextPool::NumPoolMisses.load(std::memory_order_relaxed);
+}
+
+bool FAuraGameplayEffectContext::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace AuraEffectContextNet;
+
+	const bool bBaseSuccess = Super::NetSerialize(Ar, Map, bOutSuccess);
+
+	uint32 RepBits = 0;
+	if (Ar.IsSaving())
 	{
-		if (RepBits & (1 << 0))
+		if (bIsBlockedHit)
 		{
-			Ar << bIsBlockedHit;
+			RepBits |= ERepFlags::BlockedHit;
 		}
-		if (RepBits & (1 << 1))
+		if (bIsCriticalHit)
 		{
-			Ar << bIsCriticalHit;
+			RepBits |= ERepFlags::CriticalHit;
 		}
-		if (RepBits & (1 << 2))
+		if (bIsSuccessfulDebuff)
 		{
-			Ar << bIsSuccessfulDebuff;
+			RepBits |= ERepFlags::SuccessfulDebuff;
 		}
-		if (RepBits & (1 << 3))
+		if (DebuffDamage != 0.f)
 		{
-			Ar << DebuffDamage.Value;
+			RepBits |= ERepFlags::DebuffDamage;
 		}
-		if (RepBits & (1 << 4))
+		if (DebuffDuration != 0.f)
 		{
-			Ar << DebuffDuration.Value;
+			RepBits |= ERepFlags::DebuffDuration;
 		}
-		if (RepBits & (1 << 5))
+		if (DebuffFrequency != 0.f)
 		{
-			Ar << DebuffFrequency.Value;
+			RepBits |= ERepFlags::DebuffFrequency;
 		}
-		if (RepBits & (1 << 6))
+		if (DamageType.IsValid())
 		{
-			if (Ar.IsLoading())
-			{
-				if(DamageType.IsValid())
-				{
-					DamageType = TSharedPtr<FGameplayTag>(new FGameplayTag());
-				}
-			}
-			DamageType->NetSerialize(Ar, Map, bOutSuccess);
+			RepBits |= ERepFlags::DamageType;
 		}
-		if (RepBits & (1 << 7))
+		if (!DeathImpulse.IsZero())
 		{
-			DeathImpulse.NetSerialize(Ar, Map, bOutSuccess);
+			RepBits |= ERepFlags::DeathImpulse;
 		}
-		if (RepBits & (1 << 8))
+		if (!KnockBackForce.IsZero())
 		{
-			KnockBackForce.NetSerialize(Ar, Map, bOutSuccess);
+			RepBits |= ERepFlags::KnockBackForce;
 		}
 	}
 
-	return bBaseSuccess;
-}
\ No newline at end of file
+	Ar.SerializeBits(&RepBits, ERepFlags::NumBits);
+
+	if (Ar.IsLoading())
+	{
+		bIsBlockedHit = (RepBits & ERepFlags::BlockedHit) != 0;
+		bIsCriticalHit = (RepBits & ERepFlags::CriticalHit) != 0;
+		bIsSuccessfulDebuff = (RepBits & ERepFlags::SuccessfulDebuff) != 0;
+		DebuffDamage = 0.f;
+		DebuffDuration = 0.f;
+		DebuffFrequency = 0.f;
+		DamageType = FGameplayTag();
+		DeathImpulse = FVector::ZeroVector;
+		KnockBackForce = FVector::ZeroVector;
+	}
+
+	if (RepBits & ERepFlags::DebuffDamage)
+	{
+		SerializeTenths(Ar, DebuffDamage);
+	}
+	if (RepBits & ERepFlags::DebuffDuration)
+	{
+		SerializeTenths(Ar, DebuffDuration);
+	}
+	if (RepBits & ERepFlags::DebuffFrequency)
+	{
+		SerializeTenths(Ar, DebuffFrequency);
+	}
+	if (RepBits & ERepFlags::DamageType)
+	{
+		SerializeDamageType(Ar, Map, DamageType, bOutSuccess);
+	}
+	if (RepBits & ERepFlags::DeathImpulse)
+	{
+		SerializeQuantizedVector(Ar, Map, DeathImpulse, bOutSuccess);
+	}
+	if (RepBits & ERepFlags::KnockBackForce)
+	{
+		SerializeQuantizedVector(Ar, Map, KnockBackForce, bOutSuccess);
+	}
+
+	return bBaseSuccess && !Ar.IsError();
+}
@@ -4,6 +4,7 @@
 #include "AuraAssetManager.h"
 #include "AuraGameplayTags.h"
 #include "AbilitySystemGlobals.h"
+#include "AbilitySystem/AuraAbilitySystemGlobals.h"
 
 UAuraAssetManager& UAuraAssetManager::Get()
 {
@@ -20,4 +21,5 @@ void UAuraAssetManager::StartInitialLoading()
 
 	// this is required to use target data
 	UAbilitySystemGlobals::Get().InitGlobalData();
+	UAuraAbilitySystemGlobals::Get().InitRuntimeEffects();
 }
@@ -41,6 +41,7 @@ AAuraCharacter::AAuraCharacter()
 	bUseControllerRotationRoll = false;
 
 	CharacterClass = ECharacterClass::Elementalist;
+	FactionMask = MakeFactionMask(EAuraFaction::Player);
 }
 
 void AAuraCharacter::PossessedBy(AController* NewController)
@@ -60,6 +61,12 @@ void AAuraCharacter::OnRep_PlayerState()
 	InitAbilityActorInfo();
 }
 
+const ULevelUpInfo* AAuraCharacter::GetLevelUpInfo() const
+{
+	const AAuraPlayerState* AuraPlayerState = GetPlayerState<AAuraPlayerState>();
+	return AuraPlayerState ? AuraPlayerState->LevelUpInfo.Get() : nullptr;
+}
+
 int32 AAuraCharacter::GetXP_Implementation() const
 {
 	const AAuraPlayerState* AuraPlayerState = GetPlayerState<AAuraPlayerState>();
@@ -109,7 +116,7 @@ int32 AAuraCharacter::GetSpellPointsReward_Implementation(int32 Level) const
 {
 	const AAuraPlayerState* AuraPlayerState = GetPlayerState<AAuraPlayerState>();
 	check(AuraPlayerState);
-	return AuraPlayerState->LevelUpInfo->LevelUpInformation[Level].AttributePointAwarded;
+	return AuraPlayerState->LevelUpInfo->LevelUpInformation[Level].SpellPointAwarded;
 }
 
 void AAuraCharacter::AddToPlayerLevel_Implementation(int32 InPlayerLevel)
@@ -10,6 +10,8 @@
 #include "AbilitySystem/Passive/PassiveNiagaraComponent.h"
 #include "Aura/Aura.h"
 #include "Components/CapsuleComponent.h"
+#include "Game/AuraCombatantRegistry.h"
+#include "Game/AuraCombatRandomSubsystem.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/CharacterMovementComponent.h"
@@ -99,6 +101,10 @@ void AAuraCharacterBase::MulticastHandleDeath_Implementation(const FVector& Deat
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	Dissolve();
 	bDead = true;
+	if(UAuraCombatantRegistry* CombatantRegistry = UAuraCombatantRegistry::Get(this))
+	{
+		CombatantRegistry->SetAlive(this, false);
+	}
 	BurnDebuffComponent->Deactivate();
 	StunDebuffComponent->Deactivate();
 	OnDeathDelegateSign.Broadcast(this);
@@ -120,9 +126,44 @@ void AAuraCharacterBase::OnRep_Burned()
 	
 }
 
+void AAuraCharacterBase::SetFactionMask(int32 InFactionMask)
+{
+	FactionMask = InFactionMask;
+	OnRep_FactionMask();
+}
+
+void AAuraCharacterBase::OnRep_FactionMask()
+{
+	if(UAuraCombatantRegistry* CombatantRegistry = UAuraCombatantRegistry::Get(this))
+	{
+		CombatantRegistry->SetFactionMask(this, FactionMask);
+	}
+}
+
 void AAuraCharacterBase::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if(UAuraCombatantRegistry* CombatantRegistry = UAuraCombatantRegistry::Get(this))
+	{
+		CombatantRegistry->Register(this);
+		CombatantRegistry->SetAlive(this, !bDead);
+	}
+}
+
+void AAuraCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Before unregistering, the roll subsystem reads this actor's hash from the registry
+	if(UAuraCombatRandomSubsystem* CombatRandom = GetWorld() ? GetWorld()->GetSubsystem<UAuraCombatRandomSubsystem>() : nullptr)
+	{
+		CombatRandom->ForgetActor(this);
+	}
+	if(UAuraCombatantRegistry* CombatantRegistry = UAuraCombatantRegistry::Get(this))
+	{
+		CombatantRegistry->Unregister(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 FVector AAuraCharacterBase::GetCombatSocketLocation_Implementation(const FGameplayTag& SocketTag)
@@ -276,5 +317,6 @@ void AAuraCharacterBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& O
 	DOREPLIFETIME(AAuraCharacterBase, bIsBurned);
 	DOREPLIFETIME(AAuraCharacterBase, InShockLoop);
 	DOREPLIFETIME(AAuraCharacterBase, bIsBeingShocked);
+	DOREPLIFETIME(AAuraCharacterBase, FactionMask);
 }
 
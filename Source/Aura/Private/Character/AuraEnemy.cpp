@@ -35,6 +35,7 @@ AAuraEnemy::AAuraEnemy()
 	HealthBar->SetupAttachment(GetRootComponent());
 
 	BaseWalkSpeed = 250.f;
+	FactionMask = MakeFactionMask(EAuraFaction::Enemy);
 }
 
 void AAuraEnemy::PossessedBy(AController* NewController)
@@ -0,0 +1,169 @@
+// Copyright Axchemy Games
+
+
+#include "Components/AuraCameraOcclusionComponent.h"
+
+#include "Aura/Aura.h"
+#include "Aura/AuraStats.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/World.h"
+#include "Game/AuraCombatantRegistry.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Interaction/CombatInterface.h"
+#include "Interaction/FadeInterface.h"
+
+static TAutoConsoleVariable<bool> CVarAuraCameraOcclusion(
+	TEXT("Aura.Camera.Occlusion"),
+	false,
+	TEXT("1 fades occluders from the player controller's async sweeps. 0 leaves it to the box on BP_AuraCharacter_Topdown, which is authoritative until it is removed; don't run both."),
+	ECVF_Default);
+
+UAuraCameraOcclusionComponent::UAuraCameraOcclusionComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = true;
+}
+
+void UAuraCameraOcclusionComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	const APlayerController* PlayerController = Cast<APlayerController>(GetOwner());
+	if(PlayerController == nullptr || !PlayerController->IsLocalController())
+	{
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	SweepDelegate.BindUObject(this, &UAuraCameraOcclusionComponent::OnSweepComplete);
+	SetComponentTickInterval(QueryInterval);
+}
+
+void UAuraCameraOcclusionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	RestoreOccluders();
+	Super::EndPlay(EndPlayReason);
+}
+
+void UAuraCameraOcclusionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if(!CVarAuraCameraOcclusion.GetValueOnGameThread())
+	{
+		// Turned off at runtime, hand back whatever this component faded
+		if(Occluders.Num() > 0 || NumPendingSweeps > 0)
+		{
+			RestoreOccluders();
+		}
+		return;
+	}
+	IssueQueries();
+}
+
+void UAuraCameraOcclusionComponent::RestoreOccluders()
+{
+	for(const TWeakObjectPtr<UObject>& Occluder : Occluders)
+	{
+		if(UObject* Object = Occluder.Get())
+		{
+			IFadeInterface::Execute_FadeIn(Object);
+		}
+	}
+	Occluders.Reset();
+	PendingOccluders.Reset();
+	NumPendingSweeps = 0;
+	BatchId++;
+}
+
+void UAuraCameraOcclusionComponent::IssueQueries()
+{
+	UWorld* World = GetWorld();
+
+	// Async results come back next frame, a batch still out after a second was dropped and is abandoned
+	if(NumPendingSweeps > 0 && World->GetTimeSeconds() - BatchIssueTime < 1.0) return;
+
+	const APlayerController* PlayerController = Cast<APlayerController>(GetOwner());
+	APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+	if(Pawn == nullptr || PlayerController->PlayerCameraManager == nullptr) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_Aura_OcclusionQuery);
+
+	Targets.Reset();
+	Targets.Add(Pawn);
+	if(const UAuraCombatantRegistry* Registry = UAuraCombatantRegistry::Get(this))
+	{
+		AActor* const Ignore[] = { Pawn };
+		Registry->GetKNearest(Pawn->GetActorLocation(), MaxHostiles, HostileRadius, Targets, Ignore, 0, ICombatInterface::GetFactionMaskOf(Pawn));
+	}
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AuraCameraOcclusion), false);
+	QueryParams.AddIgnoredActors(Targets);
+
+	// Overlap everything so occluders blocking the channel don't hide the ones behind them
+	const FCollisionResponseParams ResponseParams(ECR_Overlap);
+	const FVector CameraLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+
+	BatchId++;
+	BatchIssueTime = World->GetTimeSeconds();
+	NumPendingSweeps = Targets.Num();
+	PendingOccluders.Reset();
+
+	for(const AActor* Target : Targets)
+	{
+		World->AsyncSweepByChannel(EAsyncTraceType::Multi, CameraLocation, Target->GetActorLocation(), FQuat::Identity, ECC_FadeActor,
+			FCollisionShape::MakeSphere(SweepRadius), QueryParams, ResponseParams, &SweepDelegate, BatchId);
+	}
+	INC_DWORD_STAT_BY(STAT_Aura_OcclusionSweeps, Targets.Num());
+}
+
+void UAuraCameraOcclusionComponent::OnSweepComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	if(TraceDatum.UserData != BatchId || NumPendingSweeps == 0) return;
+
+	for(const FHitResult& Hit : TraceDatum.OutHits)
+	{
+		if(UObject* FadeTarget = FindFadeTarget(Hit.GetActor()))
+		{
+			PendingOccluders.Add(FadeTarget);
+		}
+	}
+
+	if(--NumPendingSweeps == 0)
+	{
+		ResolveQueries();
+	}
+}
+
+void UAuraCameraOcclusionComponent::ResolveQueries()
+{
+	for(const TWeakObjectPtr<UObject>& Occluder : PendingOccluders)
+	{
+		UObject* Object = Occluder.Get();
+		if(Object != nullptr && !Occluders.Contains(Occluder))
+		{
+			IFadeInterface::Execute_FadeOut(Object);
+			INC_DWORD_STAT(STAT_Aura_OcclusionFadeChanges);
+		}
+	}
+	for(const TWeakObjectPtr<UObject>& Occluder : Occluders)
+	{
+		UObject* Object = Occluder.Get();
+		if(Object != nullptr && !PendingOccluders.Contains(Occluder))
+		{
+			IFadeInterface::Execute_FadeIn(Object);
+			INC_DWORD_STAT(STAT_Aura_OcclusionFadeChanges);
+		}
+	}
+
+	Swap(Occluders, PendingOccluders);
+	PendingOccluders.Reset();
+}
+
+UObject* UAuraCameraOcclusionComponent::FindFadeTarget(AActor* Actor)
+{
+	if(Actor == nullptr) return nullptr;
+	if(Actor->Implements<UFadeInterface>()) return Actor;
+	return Actor->FindComponentByInterface(UFadeInterface::StaticClass());
+}
@@ -0,0 +1,156 @@
+// Copyright Axchemy Games
+
+
+#include "Components/AuraCursorHitComponent.h"
+
+#include "Aura/Aura.h"
+#include "Aura/AuraStats.h"
+#include "Engine/World.h"
+#include "Game/AuraCombatantRegistry.h"
+#include "GameFramework/PlayerController.h"
+
+static TAutoConsoleVariable<float> CVarAuraCursorMaxTraceAge(
+	TEXT("Aura.Cursor.MaxTraceAge"),
+	0.25f,
+	TEXT("Seconds a cached cursor hit is reused while nothing around it changes."),
+	ECVF_Default);
+
+UAuraCursorHitComponent::UAuraCursorHitComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	ChannelHits[0].Channel = ECC_Visibility;
+	ChannelHits[1].Channel = ECC_Target;
+}
+
+void UAuraCursorHitComponent::BeginPlay()
+{
+	Super::BeginPlay();
+	TraceDelegate.BindUObject(this, &UAuraCursorHitComponent::OnTraceComplete);
+}
+
+bool UAuraCursorHitComponent::GetCursorRay(FVector& OutOrigin, FVector& OutDirection) const
+{
+	const APlayerController* PlayerController = Cast<APlayerController>(GetOwner());
+	return PlayerController && PlayerController->DeprojectMousePositionToWorld(OutOrigin, OutDirection);
+}
+
+UAuraCursorHitComponent::FChannelHit* UAuraCursorHitComponent::FindChannel(ECollisionChannel Channel)
+{
+	for(FChannelHit& ChannelHit : ChannelHits)
+	{
+		if(ChannelHit.Channel == Channel) return &ChannelHit;
+	}
+	return nullptr;
+}
+
+FVector UAuraCursorHitComponent::GetNearbySignature(const FVector& Location) const
+{
+	// Sum of the positions of the combatants around the hit, changes when any of them moves, enters or leaves
+	FVector Signature = FVector::ZeroVector;
+	if(const UAuraCombatantRegistry* Registry = UAuraCombatantRegistry::Get(this))
+	{
+		TArray<AActor*, TInlineAllocator<16>> Nearby;
+		Registry->GetAliveInRadius(Location, NearbyRadius, Nearby);
+		for(const AActor* Actor : Nearby)
+		{
+			Signature += Actor->GetActorLocation();
+		}
+	}
+	return Signature;
+}
+
+bool UAuraCursorHitComponent::IsStale(const FChannelHit& ChannelHit, const FVector& RayOrigin, const FVector& RayDirection) const
+{
+	if(ChannelHit.TraceTime < 0.0) return true;
+	if(GetWorld()->GetTimeSeconds() - ChannelHit.TraceTime > CVarAuraCursorMaxTraceAge.GetValueOnGameThread()) return true;
+	if(!RayOrigin.Equals(ChannelHit.RayOrigin, 0.1) || !RayDirection.Equals(ChannelHit.RayDirection, 1.e-5)) return true;
+
+	if(const AActor* HitActor = ChannelHit.Hit.GetActor())
+	{
+		if(!HitActor->GetActorLocation().Equals(ChannelHit.HitActorLocation, 0.1)) return true;
+	}
+	const FVector HitLocation = ChannelHit.Hit.bBlockingHit ? ChannelHit.Hit.ImpactPoint : ChannelHit.Hit.TraceEnd;
+	return !GetNearbySignature(HitLocation).Equals(ChannelHit.NearbySignature, 0.1);
+}
+
+void UAuraCursorHitComponent::StoreHit(FChannelHit& ChannelHit, const FHitResult& Hit, const FVector& RayOrigin, const FVector& RayDirection)
+{
+	ChannelHit.Hit = Hit;
+	ChannelHit.RayOrigin = RayOrigin;
+	ChannelHit.RayDirection = RayDirection;
+	ChannelHit.HitActorLocation = Hit.GetActor() ? Hit.GetActor()->GetActorLocation() : FVector::ZeroVector;
+	ChannelHit.NearbySignature = GetNearbySignature(Hit.bBlockingHit ? Hit.ImpactPoint : Hit.TraceEnd);
+	ChannelHit.TraceTime = GetWorld()->GetTimeSeconds();
+}
+
+void UAuraCursorHitComponent::UpdateTraces()
+{
+	FVector RayOrigin;
+	FVector RayDirection;
+	if(!GetCursorRay(RayOrigin, RayDirection)) return;
+
+	const APlayerController* PlayerController = CastChecked<APlayerController>(GetOwner());
+	const FVector RayEnd = RayOrigin + RayDirection * PlayerController->HitResultTraceDistance;
+	const FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AuraCursorTrace), false);
+
+	for(FChannelHit& ChannelHit : ChannelHits)
+	{
+		if(ChannelHit.bPending) continue;
+		if(!IsStale(ChannelHit, RayOrigin, RayDirection))
+		{
+			INC_DWORD_STAT(STAT_Aura_CursorTraceReuses);
+			continue;
+		}
+
+		ChannelHit.bPending = true;
+		ChannelHit.PendingId = ++NextTraceId;
+		ChannelHit.PendingOrigin = RayOrigin;
+		ChannelHit.PendingDirection = RayDirection;
+		GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, RayOrigin, RayEnd, ChannelHit.Channel, QueryParams,
+			FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, ChannelHit.PendingId);
+		INC_DWORD_STAT(STAT_Aura_CursorTracesAsync);
+	}
+}
+
+void UAuraCursorHitComponent::OnTraceComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	for(FChannelHit& ChannelHit : ChannelHits)
+	{
+		if(!ChannelHit.bPending || ChannelHit.PendingId != TraceDatum.UserData) continue;
+
+		ChannelHit.bPending = false;
+		FHitResult Hit;
+		if(TraceDatum.OutHits.Num() > 0)
+		{
+			Hit = TraceDatum.OutHits[0];
+		}
+		else
+		{
+			Hit.TraceStart = TraceDatum.Start;
+			Hit.TraceEnd = TraceDatum.End;
+		}
+		StoreHit(ChannelHit, Hit, ChannelHit.PendingOrigin, ChannelHit.PendingDirection);
+		return;
+	}
+}
+
+const FHitResult& UAuraCursorHitComponent::GetHitResult(ECollisionChannel Channel, bool bRequireCurrent)
+{
+	FChannelHit* ChannelHit = FindChannel(Channel);
+	check(ChannelHit);
+
+	FVector RayOrigin;
+	FVector RayDirection;
+	if(bRequireCurrent && GetCursorRay(RayOrigin, RayDirection) && IsStale(*ChannelHit, RayOrigin, RayDirection))
+	{
+		SCOPE_CYCLE_COUNTER(STAT_Aura_CursorTraceSync);
+
+		// Supersedes whatever is in flight for this channel
+		ChannelHit->bPending = false;
+		FHitResult Hit;
+		CastChecked<APlayerController>(GetOwner())->GetHitResultUnderCursor(Channel, false, Hit);
+		StoreHit(*ChannelHit, Hit, RayOrigin, RayDirection);
+	}
+	return ChannelHit->Hit;
+}
@@ -0,0 +1,176 @@
+// Copyright Axchemy Games
+
+
+#include "Components/AuraPathRequestComponent.h"
+
+#include "NavigationSystem.h"
+#include "Aura/AuraStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+static TAutoConsoleVariable<float> CVarAuraClickMovePathCacheCellSize(
+	TEXT("Aura.ClickMove.PathCacheCellSize"),
+	100.f,
+	TEXT("Size in cm of the cells path start and goal are snapped to for the click-to-move path cache."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAuraClickMovePathCacheLifetime(
+	TEXT("Aura.ClickMove.PathCacheLifetime"),
+	5.f,
+	TEXT("Seconds a cached click-to-move path is reused. Keeps paths from outliving navmesh changes for long. 0 disables the cache."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAuraClickMovePathCacheSize(
+	TEXT("Aura.ClickMove.PathCacheSize"),
+	16,
+	TEXT("Click-to-move paths kept in the cache, the least recently used one is dropped first."),
+	ECVF_Default);
+
+UAuraPathRequestComponent::UAuraPathRequestComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UAuraPathRequestComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CancelRequest();
+	CachedPaths.Empty();
+	Super::EndPlay(EndPlayReason);
+}
+
+FIntVector UAuraPathRequestComponent::CellOf(const FVector& Location)
+{
+	const float InvCellSize = 1.f / FMath::Max(CVarAuraClickMovePathCacheCellSize.GetValueOnGameThread(), 1.f);
+	return FIntVector(FMath::FloorToInt32(Location.X * InvCellSize), FMath::FloorToInt32(Location.Y * InvCellSize), FMath::FloorToInt32(Location.Z * InvCellSize));
+}
+
+UAuraPathRequestComponent::FCachedPath* UAuraPathRequestComponent::FindCachedPath(const FIntVector& StartCell, const FIntVector& GoalCell)
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	const double Lifetime = CVarAuraClickMovePathCacheLifetime.GetValueOnGameThread();
+	for(int32 i = CachedPaths.Num() - 1; i >= 0; i--)
+	{
+		if(Now - CachedPaths[i].FoundTime > Lifetime)
+		{
+			CachedPaths.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+	}
+
+	for(FCachedPath& CachedPath : CachedPaths)
+	{
+		if(CachedPath.StartCell == StartCell && CachedPath.GoalCell == GoalCell)
+		{
+			CachedPath.LastUsedTime = Now;
+			return &CachedPath;
+		}
+	}
+	return nullptr;
+}
+
+void UAuraPathRequestComponent::CachePath(const FIntVector& StartCell, const FIntVector& GoalCell, const TArray<FVector>& Points)
+{
+	const int32 MaxPaths = CVarAuraClickMovePathCacheSize.GetValueOnGameThread();
+	if(MaxPaths <= 0 || CVarAuraClickMovePathCacheLifetime.GetValueOnGameThread() <= 0.f) return;
+
+	FCachedPath* Entry = FindCachedPath(StartCell, GoalCell);
+	if(Entry == nullptr)
+	{
+		while(CachedPaths.Num() >= MaxPaths)
+		{
+			int32 Oldest = 0;
+			for(int32 i = 1; i < CachedPaths.Num(); i++)
+			{
+				if(CachedPaths[i].LastUsedTime < CachedPaths[Oldest].LastUsedTime) Oldest = i;
+			}
+			CachedPaths.RemoveAtSwap(Oldest, EAllowShrinking::No);
+		}
+		Entry = &CachedPaths.AddDefaulted_GetRef();
+		Entry->StartCell = StartCell;
+		Entry->GoalCell = GoalCell;
+	}
+	Entry->Points = Points;
+	Entry->FoundTime = Entry->LastUsedTime = GetWorld()->GetTimeSeconds();
+}
+
+bool UAuraPathRequestComponent::RequestPath(const FVector& Goal, const FAuraPathReadyDelegate& OnReady)
+{
+	const APlayerController* PlayerController = Cast<APlayerController>(GetOwner());
+	const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	if(Pawn == nullptr || NavSys == nullptr) return false;
+
+	if(IsRequestPending())
+	{
+		INC_DWORD_STAT(STAT_Aura_ClickMovePathsSuperseded);
+	}
+	CancelRequest();
+
+	const FVector Start = Pawn->GetNavAgentLocation();
+	const FNavAgentProperties& AgentProperties = Pawn->GetNavAgentPropertiesRef();
+	const ANavigationData* NavData = NavSys->GetNavDataForProps(AgentProperties, Start);
+	if(NavData == nullptr) return false;
+
+	const FIntVector StartCell = CellOf(Start);
+	const FIntVector GoalCell = CellOf(Goal);
+	if(const FCachedPath* CachedPath = FindCachedPath(StartCell, GoalCell))
+	{
+		// Same cells, so the path only needs to begin where the pawn is and end where this click landed
+		FNavLocation ProjectedGoal;
+		if(NavSys->ProjectPointToNavigation(Goal, ProjectedGoal, INVALID_NAVEXTENT, NavData))
+		{
+			INC_DWORD_STAT(STAT_Aura_ClickMovePathCacheHits);
+
+			TArray<FVector> Points = CachedPath->Points;
+			Points[0] = Start;
+			Points.Last() = ProjectedGoal.Location;
+			OnReady.ExecuteIfBound(Points);
+			return true;
+		}
+	}
+
+	FPathFindingQuery Query(this, *NavData, Start, Goal, NavData->GetDefaultQueryFilter());
+	PendingQueryId = NavSys->FindPathAsync(AgentProperties, Query,
+		FNavPathQueryDelegate::CreateUObject(this, &UAuraPathRequestComponent::OnPathFound), EPathFindingMode::Regular);
+	if(PendingQueryId == INVALID_NAVQUERYID) return false;
+
+	PendingStartCell = StartCell;
+	PendingGoalCell = GoalCell;
+	PendingRequestTime = FPlatformTime::Seconds();
+	PendingOnReady = OnReady;
+	INC_DWORD_STAT(STAT_Aura_ClickMovePathRequests);
+	return true;
+}
+
+void UAuraPathRequestComponent::CancelRequest()
+{
+	if(PendingQueryId == INVALID_NAVQUERYID) return;
+
+	if(UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+	{
+		NavSys->AbortAsyncFindPathRequest(PendingQueryId);
+	}
+	PendingQueryId = INVALID_NAVQUERYID;
+	PendingOnReady.Unbind();
+}
+
+void UAuraPathRequestComponent::OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	// An aborted query can still report if it was already being processed
+	if(QueryId != PendingQueryId) return;
+
+	PendingQueryId = INVALID_NAVQUERYID;
+	FAuraPathReadyDelegate OnReady = MoveTemp(PendingOnReady);
+	SET_FLOAT_STAT(STAT_Aura_ClickMovePathLatency, (FPlatformTime::Seconds() - PendingRequestTime) * 1000.0);
+
+	if(Result != ENavigationQueryResult::Success || !Path.IsValid() || Path->GetPathPoints().Num() == 0) return;
+
+	TArray<FVector> Points;
+	Points.Reserve(Path->GetPathPoints().Num());
+	for(const FNavPathPoint& PathPoint : Path->GetPathPoints())
+	{
+		Points.Add(PathPoint.Location);
+	}
+	CachePath(PendingStartCell, PendingGoalCell, Points);
+	OnReady.ExecuteIfBound(Points);
+}
@@ -3,7 +3,11 @@
 
 #include "Components/FadeObjectComponent.h"
 
+#include "Components/StaticMeshComponent.h"
+#include "Curves/CurveFloat.h"
+#include "Game/AuraFadeManager.h"
 #include "Kismet/KismetMaterialLibrary.h"
+#include "Materials/MaterialInstanceDynamic.h"
 
 UFadeObjectComponent::UFadeObjectComponent()
 {
@@ -14,7 +18,7 @@ void UFadeObjectComponent::ResetMaterials()
 {
 	for (int32 Index = 0; Index < OriginalMaterials.Num(); Index++)
 	{
-		Mesh->CreateDynamicMaterialInstance(Index, OriginalMaterials[Index]);
+		Mesh->SetMaterial(Index, OriginalMaterials[Index]);
 	}
 }
 
@@ -45,8 +49,7 @@ void UFadeObjectComponent::SetMaterialToDynamicInstances()
 {
 	for (int32 Index = 0; Index < DynamicMaterialInstances.Num(); Index++)
 	{
-		UMaterialInstanceDynamic* DynamicMaterialInstance = DynamicMaterialInstances[Index];
-		Mesh->CreateDynamicMaterialInstance(Index, DynamicMaterialInstance);
+		Mesh->SetMaterial(Index, DynamicMaterialInstances[Index]);
 	}
 }
 
@@ -61,53 +64,52 @@ void UFadeObjectComponent::SetupMaterials()
 	}
 }
 
+void UFadeObjectComponent::ApplyFadeValue()
+{
+	const float Fade = FadeCurve ? FadeCurve->GetFloatValue(AnimationProgress) : AnimationProgress;
+	for(UMaterialInstanceDynamic* DynamicMaterialInstance : DynamicMaterialInstances)
+	{
+		if(DynamicMaterialInstance)
+		{
+			DynamicMaterialInstance->SetScalarParameterValue(FName("Fade"), Fade);
+		}
+	}
+}
+
 void UFadeObjectComponent::FadeOut_Implementation()
 {
-	SetMaterialToDynamicInstances();
-	GetWorld()->GetTimerManager().SetTimer(FadeOutTimer, this, &UFadeObjectComponent::SetFadeOut, FadeTime, true);
+	if(Mesh == nullptr) return;
+
+	// Fade materials only go on when starting from fully visible, a fade in that gets reversed keeps them
+	if(AnimationProgress >= 1.0f)
+	{
+		SetMaterialToDynamicInstances();
+		ApplyFadeValue();
+	}
+	if(UAuraFadeManager* FadeManager = UAuraFadeManager::Get(this))
+	{
+		FadeManager->Fade(this, true);
+	}
 }
 
 void UFadeObjectComponent::FadeIn_Implementation()
 {
-	GetWorld()->GetTimerManager().SetTimer(FadeOutTimer, this, &UFadeObjectComponent::SetFadeIn, FadeTime, true);
+	if(Mesh == nullptr) return;
+
+	if(UAuraFadeManager* FadeManager = UAuraFadeManager::Get(this))
+	{
+		FadeManager->Fade(this, false);
+	}
 }
 
 void UFadeObjectComponent::SetFadeOut()
 {
-	if(AnimationProgress >= 0.0f)
-	{
-		AnimationProgress -= 0.01f;
-		if(AnimationProgress <= 0.0f)
-		{
-			GetWorld()->GetTimerManager().ClearTimer(FadeOutTimer);
-		}
-		else
-		{
-			for (int32 Index = 0; Index < DynamicMaterialInstances.Num(); Index++)
-			{
-				UMaterialInstanceDynamic* DynamicMaterialInstance = DynamicMaterialInstances[Index];
-				DynamicMaterialInstance->SetScalarParameterValue(FName("Fade"), AnimationProgress);
-			}
-		}
-	}
+	Execute_FadeOut(this);
 }
 
 void UFadeObjectComponent::SetFadeIn()
 {
-	AnimationProgress += 0.01f;
-	if(AnimationProgress >= 1.0f)
-	{
-		GetWorld()->GetTimerManager().ClearTimer(FadeOutTimer);
-		FadeFinish(AnimationProgress);
-	}
-	else
-	{
-		for (int32 Index = 0; Index < DynamicMaterialInstances.Num(); Index++)
-		{
-			UMaterialInstanceDynamic* DynamicMaterialInstance = DynamicMaterialInstances[Index];
-			DynamicMaterialInstance->SetScalarParameterValue(FName("Fade"), AnimationProgress);
-		}
-	}
+	Execute_FadeIn(this);
 }
 
 void UFadeObjectComponent::BeginPlay()
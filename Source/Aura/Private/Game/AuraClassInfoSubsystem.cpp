@@ -0,0 +1,20 @@
+// Copyright Axchemy Games
+
+
+#include "Game/AuraClassInfoSubsystem.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Game/Data/CharacterClassInfo.h"
+
+UCharacterClassInfo* UAuraClassInfoSubsystem::GetCharacterClassInfo(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	const UAuraClassInfoSubsystem* Subsystem = World ? World->GetSubsystem<UAuraClassInfoSubsystem>() : nullptr;
+	return Subsystem ? Subsystem->CharacterClassInfo.Get() : nullptr;
+}
+
+bool UAuraClassInfoSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,125 @@
+// Copyright Axchemy Games
+
+
+#include "Game/AuraCombatRandomSubsystem.h"
+
+#include "Aura/AuraLogChannels.h"
+#include "Engine/World.h"
+#include "Game/AuraCombatantRegistry.h"
+#include "GameFramework/Actor.h"
+#include "Misc/StringBuilder.h"
+
+static TAutoConsoleVariable<int32> CVarAuraCombatRandomSeed(
+	TEXT("Aura.Combat.RandomSeed"),
+	0,
+	TEXT("Seed for combat rolls in newly created worlds. 0 picks a different seed every run."),
+	ECVF_Default);
+
+static FAutoConsoleCommandWithWorldAndArgs AuraCombatReseedCommand(
+	TEXT("Aura.Combat.Reseed"),
+	TEXT("Aura.Combat.Reseed <Seed>. Reseeds combat rolls in the current world and restarts every roll sequence."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		UAuraCombatRandomSubsystem* Subsystem = World ? World->GetSubsystem<UAuraCombatRandomSubsystem>() : nullptr;
+		if(Subsystem && Args.Num() > 0)
+		{
+			Subsystem->SetSeed(FCString::Strtoui64(*Args[0], nullptr, 10));
+		}
+	}));
+
+uint32 UAuraCombatRandomSubsystem::StableActorHash(const AActor* Actor)
+{
+	if(Actor == nullptr) return 0;
+
+	TStringBuilder<128> Name;
+	Actor->GetFName().AppendString(Name);
+	return FCrc::StrCrc32(Name.ToString());
+}
+
+uint32 UAuraCombatRandomSubsystem::GetStableHash(const AActor* Actor) const
+{
+	return CombatantRegistry ? CombatantRegistry->GetStableHash(Actor) : StableActorHash(Actor);
+}
+
+FAuraCombatRollStream UAuraCombatRandomSubsystem::MakeRollStream(const UObject* WorldContextObject, const AActor* Source, const AActor* Target, int32 PredictionKey)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if(UAuraCombatRandomSubsystem* Subsystem = World ? World->GetSubsystem<UAuraCombatRandomSubsystem>() : nullptr)
+	{
+		return Subsystem->BeginRolls(Source, Target, PredictionKey);
+	}
+
+	FAuraCombatRollStream Stream;
+	Stream.Key = (static_cast<uint64>(FMath::Rand32()) << 32) | FMath::Rand32();
+	return Stream;
+}
+
+FAuraCombatRollStream UAuraCombatRandomSubsystem::BeginRolls(const AActor* Source, const AActor* Target, int32 PredictionKey)
+{
+	const uint32 SourceHash = GetStableHash(Source);
+	const uint32 TargetHash = GetStableHash(Target);
+	const uint64 PairKey = (static_cast<uint64>(SourceHash) << 32) | TargetHash;
+
+	uint32* Counter = PairEventCounters.Find(PairKey);
+	if(Counter == nullptr)
+	{
+		Counter = &PairEventCounters.Add(PairKey, 0);
+		PairKeysByActor.FindOrAdd(SourceHash).Add(PairKey);
+		if(TargetHash != SourceHash)
+		{
+			PairKeysByActor.FindOrAdd(TargetHash).Add(PairKey);
+		}
+	}
+	const uint32 EventIndex = (*Counter)++;
+
+	FAuraCombatRollStream Stream;
+	Stream.Key = FAuraCombatRollStream::Mix(Seed ^ FAuraCombatRollStream::Mix(PairKey) ^ FAuraCombatRollStream::Mix((static_cast<uint64>(static_cast<uint32>(PredictionKey)) << 32) | EventIndex));
+	return Stream;
+}
+
+void UAuraCombatRandomSubsystem::ForgetActor(const AActor* Actor)
+{
+	const uint32 ActorHash = GetStableHash(Actor);
+	TArray<uint64> PairKeys;
+	if(!PairKeysByActor.RemoveAndCopyValue(ActorHash, PairKeys)) return;
+
+	for(const uint64 PairKey : PairKeys)
+	{
+		PairEventCounters.Remove(PairKey);
+
+		// The other side of the pair keeps its list, minus this key
+		const uint32 SourceHash = static_cast<uint32>(PairKey >> 32);
+		const uint32 OtherHash = SourceHash == ActorHash ? static_cast<uint32>(PairKey) : SourceHash;
+		if(TArray<uint64>* OtherKeys = PairKeysByActor.Find(OtherHash))
+		{
+			OtherKeys->RemoveSingleSwap(PairKey, EAllowShrinking::No);
+			if(OtherKeys->Num() == 0)
+			{
+				PairKeysByActor.Remove(OtherHash);
+			}
+		}
+	}
+}
+
+void UAuraCombatRandomSubsystem::SetSeed(uint64 InSeed)
+{
+	Seed = InSeed;
+	PairEventCounters.Reset();
+	PairKeysByActor.Reset();
+	UE_LOG(LogAura, Log, TEXT("Combat random seed for [%s] is %llu"), *GetNameSafe(GetWorld()), Seed);
+}
+
+void UAuraCombatRandomSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CombatantRegistry = Collection.InitializeDependency<UAuraCombatantRegistry>();
+
+	const int32 ConfiguredSeed = CVarAuraCombatRandomSeed.GetValueOnGameThread();
+	SetSeed(ConfiguredSeed != 0 ? static_cast<uint64>(ConfiguredSeed) : FPlatformTime::Cycles64());
+}
+
+bool UAuraCombatRandomSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,309 @@
+// Copyright Axchemy Games
+
+
+#include "Game/AuraCombatantRegistry.h"
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Game/AuraCombatRandomSubsystem.h"
+#include "GameFramework/Actor.h"
+#include "Interaction/CombatInterface.h"
+
+static TAutoConsoleVariable<float> CVarAuraCombatantCellSize(
+	TEXT("Aura.Combatants.CellSize"),
+	1000.f,
+	TEXT("Size of a combatant registry grid cell in cm, read when a world starts. Around the most common query radius works best."),
+	ECVF_Default);
+
+UAuraCombatantRegistry* UAuraCombatantRegistry::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UAuraCombatantRegistry>() : nullptr;
+}
+
+void UAuraCombatantRegistry::Register(AActor* Combatant)
+{
+	if(!IsValid(Combatant) || ActorToIndex.Contains(Combatant)) return;
+
+	FCombatant& Entry = Combatants.AddDefaulted_GetRef();
+	Entry.Actor = Combatant;
+	Entry.Location = Combatant->GetActorLocation();
+	Entry.Radius = Combatant->GetSimpleCollisionRadius();
+	Entry.Cell = CellOf(Entry.Location);
+	Entry.FactionMask = ICombatInterface::GetFactionMaskOf(Combatant);
+	Entry.StableHash = UAuraCombatRandomSubsystem::StableActorHash(Combatant);
+	MaxCombatantRadius = FMath::Max(MaxCombatantRadius, Entry.Radius);
+
+	const int32 Index = Combatants.Num() - 1;
+	ActorToIndex.Add(Combatant, Index);
+	AddToCell(Index);
+}
+
+void UAuraCombatantRegistry::Unregister(const AActor* Combatant)
+{
+	int32 Index = INDEX_NONE;
+	if(!ActorToIndex.RemoveAndCopyValue(Combatant, Index)) return;
+
+	RemoveFromCell(Index);
+
+	const int32 LastIndex = Combatants.Num() - 1;
+	if(Index != LastIndex)
+	{
+		// The last entry moves into the hole, point its map and cell slots at the new index
+		const FCombatant& Moved = Combatants[LastIndex];
+		ActorToIndex.FindChecked(Moved.Actor) = Index;
+		TArray<int32>& Cell = Cells.FindChecked(Moved.Cell);
+		Cell[Cell.IndexOfByKey(LastIndex)] = Index;
+	}
+	Combatants.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void UAuraCombatantRegistry::SetAlive(const AActor* Combatant, bool bAlive)
+{
+	if(const int32* Index = ActorToIndex.Find(Combatant))
+	{
+		Combatants[*Index].bAlive = bAlive;
+	}
+}
+
+void UAuraCombatantRegistry::SetFactionMask(const AActor* Combatant, int32 FactionMask)
+{
+	if(const int32* Index = ActorToIndex.Find(Combatant))
+	{
+		Combatants[*Index].FactionMask = FactionMask;
+	}
+}
+
+uint32 UAuraCombatantRegistry::GetStableHash(const AActor* Actor) const
+{
+	if(const int32* Index = ActorToIndex.Find(Actor))
+	{
+		return Combatants[*Index].StableHash;
+	}
+	return UAuraCombatRandomSubsystem::StableActorHash(Actor);
+}
+
+void UAuraCombatantRegistry::RefreshLocations()
+{
+	for(int32 i = 0; i < Combatants.Num(); i++)
+	{
+		FCombatant& Entry = Combatants[i];
+		if(!IsValid(Entry.Actor)) continue;
+
+		Entry.Location = Entry.Actor->GetActorLocation();
+		const FIntPoint NewCell = CellOf(Entry.Location);
+		if(NewCell != Entry.Cell)
+		{
+			RemoveFromCell(i);
+			Entry.Cell = NewCell;
+			AddToCell(i);
+		}
+	}
+}
+
+void UAuraCombatantRegistry::AddToCell(int32 CombatantIndex)
+{
+	const FIntPoint Cell = Combatants[CombatantIndex].Cell;
+	Cells.FindOrAdd(Cell).Add(CombatantIndex);
+	CellBoundsMin = FIntPoint(FMath::Min(CellBoundsMin.X, Cell.X), FMath::Min(CellBoundsMin.Y, Cell.Y));
+	CellBoundsMax = FIntPoint(FMath::Max(CellBoundsMax.X, Cell.X), FMath::Max(CellBoundsMax.Y, Cell.Y));
+}
+
+void UAuraCombatantRegistry::RemoveFromCell(int32 CombatantIndex)
+{
+	const FIntPoint Cell = Combatants[CombatantIndex].Cell;
+	if(TArray<int32>* Entries = Cells.Find(Cell))
+	{
+		Entries->RemoveSingleSwap(CombatantIndex, EAllowShrinking::No);
+		if(Entries->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+template<typename VisitorType>
+void UAuraCombatantRegistry::ForEachInBox(const FVector& Origin, float HalfExtent, VisitorType&& Visit) const
+{
+	const FIntPoint Min = CellOf(Origin - FVector(HalfExtent, HalfExtent, 0.f));
+	const FIntPoint Max = CellOf(Origin + FVector(HalfExtent, HalfExtent, 0.f));
+	const int64 NumBoxCells = static_cast<int64>(Max.X - Min.X + 1) * (Max.Y - Min.Y + 1);
+
+	// A box wider than the occupied grid is cheaper to answer from the occupied cells
+	if(NumBoxCells > Cells.Num())
+	{
+		for(const TPair<FIntPoint, TArray<int32>>& Cell : Cells)
+		{
+			if(Cell.Key.X < Min.X || Cell.Key.X > Max.X || Cell.Key.Y < Min.Y || Cell.Key.Y > Max.Y) continue;
+			for(const int32 Index : Cell.Value)
+			{
+				Visit(Index);
+			}
+		}
+		return;
+	}
+
+	for(int32 Y = Min.Y; Y <= Max.Y; Y++)
+	{
+		for(int32 X = Min.X; X <= Max.X; X++)
+		{
+			if(const TArray<int32>* Entries = Cells.Find(FIntPoint(X, Y)))
+			{
+				for(const int32 Index : *Entries)
+				{
+					Visit(Index);
+				}
+			}
+		}
+	}
+}
+
+void UAuraCombatantRegistry::GetAliveInRadius(const FVector& Origin, float Radius, TArray<AActor*>& OutActors, TConstArrayView<AActor*> ActorsToIgnore) const
+{
+	ForEachInBox(Origin, Radius + MaxCombatantRadius, [&](int32 Index)
+	{
+		const FCombatant& Entry = Combatants[Index];
+		if(!Entry.bAlive || ActorsToIgnore.Contains(Entry.Actor)) return;
+		if(FVector::DistSquared(Origin, Entry.Location) <= FMath::Square(Radius + Entry.Radius))
+		{
+			OutActors.Add(Entry.Actor);
+		}
+	});
+}
+
+void UAuraCombatantRegistry::GetKNearest(const FVector& Origin, int32 K, float Radius, TArray<AActor*>& OutActors, TConstArrayView<AActor*> ActorsToIgnore, int32 IncludeFactions, int32 ExcludeFactions) const
+{
+	if(K <= 0 || Combatants.Num() == 0) return;
+
+	struct FCandidate
+	{
+		double DistSquared;
+		int32 Index;
+	};
+	// Max-heap on distance, the top is the farthest of the K kept so far. Ties go to the lower index so the result is stable.
+	const auto FarthestFirst = [](const FCandidate& A, const FCandidate& B)
+	{
+		return A.DistSquared != B.DistSquared ? A.DistSquared > B.DistSquared : A.Index > B.Index;
+	};
+	TArray<FCandidate, TInlineAllocator<16>> Nearest;
+
+	const auto Consider = [&](int32 Index)
+	{
+		const FCombatant& Entry = Combatants[Index];
+		if(!Entry.bAlive || (IncludeFactions != 0 && (Entry.FactionMask & IncludeFactions) == 0) || (Entry.FactionMask & ExcludeFactions) != 0) return;
+		if(ActorsToIgnore.Contains(Entry.Actor)) return;
+
+		const FCandidate Candidate{ FVector::DistSquared(Origin, Entry.Location), Index };
+		if(Radius > 0.f && Candidate.DistSquared > FMath::Square(Radius + Entry.Radius)) return;
+
+		if(Nearest.Num() < K)
+		{
+			Nearest.HeapPush(Candidate, FarthestFirst);
+		}
+		else if(FarthestFirst(Nearest.HeapTop(), Candidate))
+		{
+			Nearest.HeapPopDiscard(FarthestFirst, EAllowShrinking::No);
+			Nearest.HeapPush(Candidate, FarthestFirst);
+		}
+	};
+
+	const FIntPoint Center = CellOf(Origin);
+	const int32 MaxRing = Radius > 0.f
+		? FMath::CeilToInt32((Radius + MaxCombatantRadius) * InvCellSize)
+		: FMath::Max(FMath::Max(FMath::Abs(Center.X - CellBoundsMin.X), FMath::Abs(CellBoundsMax.X - Center.X)),
+			FMath::Max(FMath::Abs(Center.Y - CellBoundsMin.Y), FMath::Abs(CellBoundsMax.Y - Center.Y)));
+
+	if(FMath::Square(2 * static_cast<int64>(MaxRing) + 1) > Combatants.Num())
+	{
+		// Sparse grid, walking every ring would visit more empty cells than there are combatants
+		for(int32 i = 0; i < Combatants.Num(); i++)
+		{
+			Consider(i);
+		}
+	}
+	else
+	{
+		const auto VisitCell = [&](int32 X, int32 Y)
+		{
+			if(const TArray<int32>* Entries = Cells.Find(FIntPoint(X, Y)))
+			{
+				for(const int32 Index : *Entries)
+				{
+					Consider(Index);
+				}
+			}
+		};
+
+		for(int32 Ring = 0; Ring <= MaxRing; Ring++)
+		{
+			if(Ring == 0)
+			{
+				VisitCell(Center.X, Center.Y);
+			}
+			else
+			{
+				for(int32 X = Center.X - Ring; X <= Center.X + Ring; X++)
+				{
+					VisitCell(X, Center.Y - Ring);
+					VisitCell(X, Center.Y + Ring);
+				}
+				for(int32 Y = Center.Y - Ring + 1; Y <= Center.Y + Ring - 1; Y++)
+				{
+					VisitCell(Center.X - Ring, Y);
+					VisitCell(Center.X + Ring, Y);
+				}
+			}
+
+			// Every cell past this ring is at least Ring cells away from the origin
+			if(Nearest.Num() == K && Nearest.HeapTop().DistSquared <= FMath::Square(Ring * static_cast<double>(CellSize)))
+			{
+				break;
+			}
+		}
+	}
+
+	Nearest.Sort([&FarthestFirst](const FCandidate& A, const FCandidate& B) { return FarthestFirst(B, A); });
+	OutActors.Reserve(OutActors.Num() + Nearest.Num());
+	for(const FCandidate& Candidate : Nearest)
+	{
+		OutActors.Add(Combatants[Candidate.Index].Actor);
+	}
+}
+
+AActor* UAuraCombatantRegistry::FindNearestHostile(const AActor* Querier, float& OutDistance) const
+{
+	OutDistance = TNumericLimits<float>::Max();
+	if(Querier == nullptr) return nullptr;
+
+	AActor* const Self[] = { const_cast<AActor*>(Querier) };
+	TArray<AActor*, TInlineAllocator<1>> Nearest;
+	GetKNearest(Querier->GetActorLocation(), 1, 0.f, Nearest, Self, 0, ICombatInterface::GetFactionMaskOf(Querier));
+	if(Nearest.Num() == 0) return nullptr;
+
+	OutDistance = Querier->GetDistanceTo(Nearest[0]);
+	return Nearest[0];
+}
+
+void UAuraCombatantRegistry::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+	RefreshLocations();
+}
+
+TStatId UAuraCombatantRegistry::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraCombatantRegistry, STATGROUP_Tickables);
+}
+
+void UAuraCombatantRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	CellSize = FMath::Max(CVarAuraCombatantCellSize.GetValueOnGameThread(), 100.f);
+	InvCellSize = 1.f / CellSize;
+}
+
+bool UAuraCombatantRegistry::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
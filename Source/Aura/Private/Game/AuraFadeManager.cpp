@@ -0,0 +1,75 @@
+// Copyright Axchemy Games
+
+
+#include "Game/AuraFadeManager.h"
+
+#include "Aura/AuraStats.h"
+#include "Components/FadeObjectComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+UAuraFadeManager* UAuraFadeManager::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UAuraFadeManager>() : nullptr;
+}
+
+void UAuraFadeManager::Fade(UFadeObjectComponent* Component, bool bFadeOut)
+{
+	if(!IsValid(Component)) return;
+
+	for(FFade& Fade : Fades)
+	{
+		if(Fade.Component == Component)
+		{
+			Fade.bFadeOut = bFadeOut;
+			return;
+		}
+	}
+
+	// Already where it was asked to go
+	if(bFadeOut ? Component->AnimationProgress <= 0.f : Component->AnimationProgress >= 1.f) return;
+
+	Fades.Add({ Component, bFadeOut });
+}
+
+void UAuraFadeManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if(Fades.Num() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_Aura_FadeUpdate);
+	INC_DWORD_STAT_BY(STAT_Aura_ActiveFades, Fades.Num());
+
+	for(int32 i = Fades.Num() - 1; i >= 0; i--)
+	{
+		UFadeObjectComponent* Component = Fades[i].Component.Get();
+		if(Component == nullptr || Component->Mesh == nullptr)
+		{
+			Fades.RemoveAtSwap(i, EAllowShrinking::No);
+			continue;
+		}
+
+		const float Step = DeltaTime / FMath::Max(Component->GetFadeDuration(), UE_KINDA_SMALL_NUMBER);
+		Component->AnimationProgress = FMath::Clamp(Component->AnimationProgress + (Fades[i].bFadeOut ? -Step : Step), 0.f, 1.f);
+		Component->ApplyFadeValue();
+
+		const bool bFinished = Fades[i].bFadeOut ? Component->AnimationProgress <= 0.f : Component->AnimationProgress >= 1.f;
+		if(bFinished)
+		{
+			Component->FadeFinish(Component->AnimationProgress);
+			Fades.RemoveAtSwap(i, EAllowShrinking::No);
+		}
+	}
+}
+
+TStatId UAuraFadeManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraFadeManager, STATGROUP_Tickables);
+}
+
+bool UAuraFadeManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -3,3 +3,20 @@
 
 #include "Game/AuraGameModeBase.h"
 
+#include "Game/AuraClassInfoSubsystem.h"
+#include "Game/Data/CharacterClassInfo.h"
+
+void AAuraGameModeBase::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+	Super::InitGame(MapName, Options, ErrorMessage);
+
+	// Rebake once per world so the damage execution always reads coefficients that match the loaded curve tables
+	if(CharacterClassInfo)
+	{
+		CharacterClassInfo->BuildCoefficientCache();
+	}
+	if(UAuraClassInfoSubsystem* ClassInfoSubsystem = GetWorld()->GetSubsystem<UAuraClassInfoSubsystem>())
+	{
+		ClassInfoSubsystem->SetCharacterClassInfo(CharacterClassInfo);
+	}
+}
@@ -0,0 +1,177 @@
+// Copyright Axchemy Games
+
+
+#include "Game/AuraProjectileManager.h"
+
+#include "Actor/AuraProjectile.h"
+#include "Aura/Aura.h"
+#include "Aura/AuraStats.h"
+#include "Components/SphereComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/ProjectileMovementComponent.h"
+
+UAuraProjectileManager* UAuraProjectileManager::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UAuraProjectileManager>() : nullptr;
+}
+
+void UAuraProjectileManager::Add(AAuraProjectile* Projectile, const FVector& Location, const FVector& Velocity, const USceneComponent* HomingTarget, float HomingAcceleration, float Lifetime)
+{
+	if(!IsValid(Projectile) || Projectile->SimIndex != INDEX_NONE) return;
+
+	const UProjectileMovementComponent* Movement = Projectile->ProjectileMovement;
+	Projectile->SimIndex = Projectiles.Add(Projectile);
+	Positions.Add(Location);
+	PreviousPositions.Add(Location);
+	Velocities.Add(Velocity);
+	HomingTargets.Add(HomingTarget);
+	HomingAccelerations.Add(HomingTarget ? HomingAcceleration : 0.f);
+	MaxSpeeds.Add(Movement->MaxSpeed);
+	GravityZs.Add(Movement->GetGravityZ());
+	Radii.Add(Projectile->Sphere->GetScaledSphereRadius());
+	RemainingLifetimes.Add(Lifetime);
+	RotationFollowsVelocity.Add(Movement->bRotationFollowsVelocity);
+}
+
+void UAuraProjectileManager::Remove(AAuraProjectile* Projectile)
+{
+	if(Projectile == nullptr || !Projectiles.IsValidIndex(Projectile->SimIndex) || Projectiles[Projectile->SimIndex] != Projectile) return;
+
+	const int32 Index = Projectile->SimIndex;
+	Projectiles.RemoveAtSwap(Index, EAllowShrinking::No);
+	Positions.RemoveAtSwap(Index, EAllowShrinking::No);
+	PreviousPositions.RemoveAtSwap(Index, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, EAllowShrinking::No);
+	HomingTargets.RemoveAtSwap(Index, EAllowShrinking::No);
+	HomingAccelerations.RemoveAtSwap(Index, EAllowShrinking::No);
+	MaxSpeeds.RemoveAtSwap(Index, EAllowShrinking::No);
+	GravityZs.RemoveAtSwap(Index, EAllowShrinking::No);
+	Radii.RemoveAtSwap(Index, EAllowShrinking::No);
+	RemainingLifetimes.RemoveAtSwap(Index, EAllowShrinking::No);
+	RotationFollowsVelocity.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	if(Projectiles.IsValidIndex(Index))
+	{
+		Projectiles[Index]->SimIndex = Index;
+	}
+	Projectile->SimIndex = INDEX_NONE;
+}
+
+void UAuraProjectileManager::Integrate(float DeltaTime)
+{
+	for(int32 i = 0; i < Projectiles.Num(); i++)
+	{
+		FVector Velocity = Velocities[i];
+		if(const USceneComponent* HomingTarget = HomingTargets[i].Get())
+		{
+			Velocity += (HomingTarget->GetComponentLocation() - Positions[i]).GetSafeNormal() * (HomingAccelerations[i] * DeltaTime);
+		}
+		Velocity.Z += GravityZs[i] * DeltaTime;
+		if(MaxSpeeds[i] > 0.f)
+		{
+			Velocity = Velocity.GetClampedToMaxSize(MaxSpeeds[i]);
+		}
+
+		Velocities[i] = Velocity;
+		PreviousPositions[i] = Positions[i];
+		Positions[i] += Velocity * DeltaTime;
+		RemainingLifetimes[i] -= DeltaTime;
+	}
+}
+
+void UAuraProjectileManager::SweepAndMove()
+{
+	UWorld* World = GetWorld();
+
+	// Hits are decided on the server only, clients just fly the projectile until the server parks it
+	const bool bSweep = World->GetNetMode() != NM_Client;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AuraProjectileSweep), false);
+
+	for(int32 i = 0; i < Projectiles.Num(); i++)
+	{
+		AAuraProjectile* Projectile = Projectiles[i];
+		if(RemainingLifetimes[i] <= 0.f)
+		{
+			PendingExpiries.Add(Projectile);
+		}
+
+		if(bSweep)
+		{
+			QueryParams.ClearIgnoredSourceObjects();
+			QueryParams.AddIgnoredActor(Projectile);
+			const FCollisionResponseParams ResponseParams(Projectile->Sphere->GetCollisionResponseToChannels());
+
+			SweepHits.Reset();
+			World->SweepMultiByChannel(SweepHits, PreviousPositions[i], Positions[i], FQuat::Identity, ECC_Projectile,
+				FCollisionShape::MakeSphere(Radii[i]), QueryParams, ResponseParams);
+			INC_DWORD_STAT(STAT_Aura_ProjectileSweeps);
+
+			for(const FHitResult& Hit : SweepHits)
+			{
+				if(AActor* HitActor = Hit.GetActor())
+				{
+					PendingImpacts.Add({ Projectile, HitActor, Hit.Location });
+				}
+			}
+		}
+
+		if(RotationFollowsVelocity[i])
+		{
+			Projectile->SetActorLocationAndRotation(Positions[i], Velocities[i].Rotation());
+		}
+		else
+		{
+			Projectile->SetActorLocation(Positions[i]);
+		}
+	}
+}
+
+void UAuraProjectileManager::ResolveEvents()
+{
+	// Sweep hits come nearest first, the first one the projectile accepts stops it
+	for(const FImpact& Impact : PendingImpacts)
+	{
+		AAuraProjectile* Projectile = Impact.Projectile.Get();
+		AActor* HitActor = Impact.Actor.Get();
+		if(Projectile == nullptr || HitActor == nullptr || Projectile->SimIndex == INDEX_NONE) continue;
+
+		Projectile->HandleImpact(HitActor, Impact.Location);
+	}
+	PendingImpacts.Reset();
+
+	for(const TWeakObjectPtr<AAuraProjectile>& WeakProjectile : PendingExpiries)
+	{
+		AAuraProjectile* Projectile = WeakProjectile.Get();
+		if(Projectile && Projectile->SimIndex != INDEX_NONE)
+		{
+			Projectile->HandleLifetimeExpired();
+		}
+	}
+	PendingExpiries.Reset();
+}
+
+void UAuraProjectileManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if(Projectiles.Num() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_Aura_ProjectileSim);
+	INC_DWORD_STAT_BY(STAT_Aura_ProjectilesSimulated, Projectiles.Num());
+
+	Integrate(DeltaTime);
+	SweepAndMove();
+	ResolveEvents();
+}
+
+TStatId UAuraProjectileManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraProjectileManager, STATGROUP_Tickables);
+}
+
+bool UAuraProjectileManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,170 @@
+// Copyright Axchemy Games
+
+
+#include "Game/AuraProjectilePool.h"
+
+#include "Actor/AuraProjectile.h"
+#include "Aura/AuraStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+static TAutoConsoleVariable<bool> CVarAuraProjectilePool(
+	TEXT("Aura.Projectiles.Pool"),
+	true,
+	TEXT("Reuse projectiles instead of spawning and destroying one per shot."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAuraProjectilePoolMaxFree(
+	TEXT("Aura.Projectiles.PoolMaxFree"),
+	64,
+	TEXT("Most parked projectiles kept per class, projectiles released past it are destroyed."),
+	ECVF_Default);
+
+UAuraProjectilePool* UAuraProjectilePool::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UAuraProjectilePool>() : nullptr;
+}
+
+AAuraProjectile* UAuraProjectilePool::SpawnProjectileDeferred(const UObject* WorldContextObject, TSubclassOf<AAuraProjectile> ProjectileClass,
+	const FTransform& Transform, AActor* Owner, APawn* Instigator)
+{
+	SCOPE_CYCLE_COUNTER(STAT_Aura_ProjectileSpawn);
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	if(World == nullptr || ProjectileClass == nullptr) return nullptr;
+
+	UAuraProjectilePool* Pool = World->GetSubsystem<UAuraProjectilePool>();
+	if(Pool != nullptr && CVarAuraProjectilePool.GetValueOnGameThread())
+	{
+		if(AAuraProjectile* Projectile = Pool->TakeFree(ProjectileClass))
+		{
+			Projectile->SetOwner(Owner);
+			Projectile->SetInstigator(Instigator);
+			Projectile->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+			INC_DWORD_STAT(STAT_Aura_ProjectilesReused);
+			return Projectile;
+		}
+	}
+
+	AAuraProjectile* Projectile = World->SpawnActorDeferred<AAuraProjectile>(
+		ProjectileClass,
+		Transform,
+		Owner,
+		Instigator,
+		ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+	);
+	if(Projectile != nullptr)
+	{
+		Projectile->OwningPool = Pool;
+		INC_DWORD_STAT(STAT_Aura_ProjectilesSpawned);
+	}
+	return Projectile;
+}
+
+void UAuraProjectilePool::FinishSpawningProjectile(AAuraProjectile* Projectile, const FTransform& Transform)
+{
+	if(Projectile == nullptr) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_Aura_ProjectileSpawn);
+
+	if(Projectile->HasActorBegunPlay())
+	{
+		Projectile->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+		Projectile->ActivateFromPool();
+	}
+	else
+	{
+		Projectile->FinishSpawning(Transform);
+	}
+}
+
+void UAuraProjectilePool::Prewarm(TSubclassOf<AAuraProjectile> ProjectileClass, int32 Count)
+{
+	UWorld* World = GetWorld();
+	if(ProjectileClass == nullptr || World == nullptr || World->GetNetMode() == NM_Client || !CVarAuraProjectilePool.GetValueOnGameThread()) return;
+
+	if(Count < 0)
+	{
+		Count = ProjectileClass->GetDefaultObject<AAuraProjectile>()->PoolPrewarmCount;
+	}
+	Count = FMath::Min(Count, CVarAuraProjectilePoolMaxFree.GetValueOnGameThread());
+
+	SCOPE_CYCLE_COUNTER(STAT_Aura_ProjectileSpawn);
+
+	FAuraProjectileFreeList& FreeList = FreeLists.FindOrAdd(ProjectileClass.Get());
+	while(FreeList.Projectiles.Num() < Count)
+	{
+		AAuraProjectile* Projectile = World->SpawnActorDeferred<AAuraProjectile>(
+			ProjectileClass,
+			FTransform::Identity,
+			nullptr,
+			nullptr,
+			ESpawnActorCollisionHandlingMethod::AlwaysSpawn
+		);
+		if(Projectile == nullptr) break;
+
+		Projectile->OwningPool = this;
+		Projectile->bSpawnIntoPool = true;
+		Projectile->FinishSpawning(FTransform::Identity);
+
+		FreeList.Projectiles.Add(Projectile);
+		NumPooled++;
+		INC_DWORD_STAT(STAT_Aura_ProjectilesSpawned);
+		INC_DWORD_STAT(STAT_Aura_ProjectilesPooled);
+	}
+}
+
+bool UAuraProjectilePool::Release(AAuraProjectile* Projectile)
+{
+	if(!IsValid(Projectile) || !CVarAuraProjectilePool.GetValueOnGameThread()) return false;
+
+	// Already parked, a hit and the life span ran out on the same frame
+	if(!Projectile->IsPoolActive()) return true;
+
+	FAuraProjectileFreeList& FreeList = FreeLists.FindOrAdd(Projectile->GetClass());
+	if(FreeList.Projectiles.Num() >= CVarAuraProjectilePoolMaxFree.GetValueOnGameThread()) return false;
+
+	Projectile->DeactivateIntoPool();
+	FreeList.Projectiles.Add(Projectile);
+	NumPooled++;
+	INC_DWORD_STAT(STAT_Aura_ProjectilesPooled);
+	return true;
+}
+
+int32 UAuraProjectilePool::NumFree(TSubclassOf<AAuraProjectile> ProjectileClass) const
+{
+	const FAuraProjectileFreeList* FreeList = FreeLists.Find(ProjectileClass.Get());
+	return FreeList ? FreeList->Projectiles.Num() : 0;
+}
+
+AAuraProjectile* UAuraProjectilePool::TakeFree(UClass* ProjectileClass)
+{
+	FAuraProjectileFreeList* FreeList = FreeLists.Find(ProjectileClass);
+	if(FreeList == nullptr) return nullptr;
+
+	while(FreeList->Projectiles.Num() > 0)
+	{
+		AAuraProjectile* Projectile = FreeList->Projectiles.Pop(EAllowShrinking::No);
+		NumPooled--;
+		DEC_DWORD_STAT(STAT_Aura_ProjectilesPooled);
+
+		// Parked projectiles can still go away with their level
+		if(IsValid(Projectile)) return Projectile;
+	}
+	return nullptr;
+}
+
+void UAuraProjectilePool::Deinitialize()
+{
+	DEC_DWORD_STAT_BY(STAT_Aura_ProjectilesPooled, NumPooled);
+	NumPooled = 0;
+	FreeLists.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UAuraProjectilePool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -3,7 +3,83 @@
 
 #include "Game/Data/CharacterClassInfo.h"
 
+#include "Aura/AuraLogChannels.h"
+#include "Engine/CurveTable.h"
+
+namespace AuraCoefficients
+{
+	// Upper bound on baked levels, guards against a stray key far out on the time axis
+	static constexpr int32 MaxBakedLevel = 400;
+
+	static void BakeCurve(const UCurveTable* CurveTable, const FName& RowName, TArray<float>& OutValues)
+	{
+		OutValues.Reset();
+		if(CurveTable == nullptr) return;
+
+		const FRealCurve* Curve = CurveTable->FindCurve(RowName, FString(), false);
+		if(Curve == nullptr)
+		{
+			UE_LOG(LogAura, Warning, TEXT("Can't find curve [%s] on CurveTable [%s]"), *RowName.ToString(), *GetNameSafe(CurveTable));
+			return;
+		}
+
+		float MinTime = 0.f;
+		float MaxTime = 0.f;
+		Curve->GetTimeRange(MinTime, MaxTime);
+		const int32 MaxLevel = FMath::Clamp(FMath::CeilToInt32(MaxTime), 1, MaxBakedLevel);
+
+		OutValues.SetNumUninitialized(MaxLevel + 1);
+		for(int32 Level = 0; Level <= MaxLevel; Level++)
+		{
+			OutValues[Level] = Curve->Eval(static_cast<float>(Level));
+		}
+	}
+}
+
 FCharacterClassDefaultInfo UCharacterClassInfo::GetClassDefaultInfo(ECharacterClass CharacterClass)
 {
 	return CharacterClassInformation.FindChecked(CharacterClass);
 }
+
+void UCharacterClassInfo::BuildCoefficientCache()
+{
+	using namespace AuraCoefficients;
+	
+	BakeCurve(DamageCalculationCoefficients, FName("ArmorPenetration"), BakedCoefficients[static_cast<uint8>(EAuraCoefficient::ArmorPenetration)]);
+	BakeCurve(DamageCalculationCoefficients, FName("EffectiveArmor"), BakedCoefficients[static_cast<uint8>(EAuraCoefficient::EffectiveArmor)]);
+	BakeCurve(DamageCalculationCoefficients, FName("CriticalHitResistance"), BakedCoefficients[static_cast<uint8>(EAuraCoefficient::CriticalHitResistance)]);
+
+	BakeCurve(PassiveAbilityCoefficients, FName("DamageReductionRatio"), BakedCoefficients[static_cast<uint8>(EAuraCoefficient::DamageReductionRatio)]);
+	BakeCurve(PassiveAbilityCoefficients, FName("LifeSiphonPercentage"), BakedCoefficients[static_cast<uint8>(EAuraCoefficient::LifeSiphonPercentage)]);
+	BakeCurve(PassiveAbilityCoefficients, FName("ManaSiphonPercentage"), BakedCoefficients[static_cast<uint8>(EAuraCoefficient::ManaSiphonPercentage)]);
+
+#if WITH_EDITOR
+	// Curve tables are edited on their own, rebake when they change
+	for(UCurveTable* CurveTable : { DamageCalculationCoefficients.Get(), PassiveAbilityCoefficients.Get() })
+	{
+		if(CurveTable)
+		{
+			CurveTable->OnCurveTableChanged().RemoveAll(this);
+			CurveTable->OnCurveTableChanged().AddUObject(this, &UCharacterClassInfo::BuildCoefficientCache);
+		}
+	}
+#endif
+}
+
+void UCharacterClassInfo::PostLoad()
+{
+	Super::PostLoad();
+
+	if(DamageCalculationCoefficients) DamageCalculationCoefficients->ConditionalPostLoad();
+	if(PassiveAbilityCoefficients) PassiveAbilityCoefficients->ConditionalPostLoad();
+	BuildCoefficientCache();
+}
+
+#if WITH_EDITOR
+void UCharacterClassInfo::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BuildCoefficientCache();
+}
+#endif
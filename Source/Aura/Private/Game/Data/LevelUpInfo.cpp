@@ -3,24 +3,81 @@
 
 #include "Game/Data/LevelUpInfo.h"
 
+#include "Algo/BinarySearch.h"
+
 int32 ULevelUpInfo::FindLevelForXP(int32 XP) const
 {
-	int32 Level = 1;
-	bool bSearching = true;
-	while(bSearching)
+	// LevelUpInformation[1] = Level 1 information
+	// LevelUpInformation[2] = Level 2 information
+	// The answer is the first level whose requirement XP hasn't met, capped at the last entry
+	const int32 MaxLevel = CumulativeRequirements.Num() - 1;
+	if(MaxLevel <= 1) return 1;
+
+	const TConstArrayView<int32> Requirements = MakeArrayView(CumulativeRequirements).Slice(1, MaxLevel - 1);
+	return 1 + Algo::UpperBound(Requirements, XP);
+}
+
+int32 ULevelUpInfo::GetAttributePointsForLevels(int32 FromLevel, int32 ToLevel) const
+{
+	if(AttributePointSums.IsEmpty()) return 0;
+
+	const int32 Last = AttributePointSums.Num() - 1;
+	return AttributePointSums[FMath::Clamp(ToLevel, 0, Last)] - AttributePointSums[FMath::Clamp(FromLevel, 0, Last)];
+}
+
+int32 ULevelUpInfo::GetSpellPointsForLevels(int32 FromLevel, int32 ToLevel) const
+{
+	if(SpellPointSums.IsEmpty()) return 0;
+
+	const int32 Last = SpellPointSums.Num() - 1;
+	return SpellPointSums[FMath::Clamp(ToLevel, 0, Last)] - SpellPointSums[FMath::Clamp(FromLevel, 0, Last)];
+}
+
+FAuraLevelUpRewards ULevelUpInfo::GetLevelUpRewards(int32 CurrentLevel, int32 TotalXP) const
+{
+	FAuraLevelUpRewards Rewards;
+	Rewards.NewLevel = FindLevelForXP(TotalXP);
+	Rewards.NumLevelUps = Rewards.NewLevel - CurrentLevel;
+	if(Rewards.NumLevelUps > 0)
 	{
-		// LevelUpInformation[1] = Level 1 information
-		// LevelUpInformation[2] = Level 2 information
-		if(LevelUpInformation.Num() -1 <= Level) return Level;
-
-		if(XP >= LevelUpInformation[Level].LevelUpRequirement)
-		{
-			++Level;
-		}
-		else
-		{
-			bSearching = false;
-		}
+		Rewards.AttributePoints = GetAttributePointsForLevels(CurrentLevel, Rewards.NewLevel);
+		Rewards.SpellPoints = GetSpellPointsForLevels(CurrentLevel, Rewards.NewLevel);
 	}
-	return Level;
+	return Rewards;
+}
+
+void ULevelUpInfo::BuildProgressionTables()
+{
+	const int32 NumLevels = LevelUpInformation.Num();
+	CumulativeRequirements.SetNumUninitialized(NumLevels);
+	AttributePointSums.SetNumUninitialized(NumLevels + 1);
+	SpellPointSums.SetNumUninitialized(NumLevels + 1);
+
+	int32 Requirement = MIN_int32;
+	AttributePointSums[0] = 0;
+	SpellPointSums[0] = 0;
+	for(int32 Level = 0; Level < NumLevels; Level++)
+	{
+		const FAuraLevelUpInfo& Info = LevelUpInformation[Level];
+		Requirement = FMath::Max(Requirement, Info.LevelUpRequirement);
+		CumulativeRequirements[Level] = Requirement;
+		AttributePointSums[Level + 1] = AttributePointSums[Level] + Info.AttributePointAwarded;
+		SpellPointSums[Level + 1] = SpellPointSums[Level] + Info.SpellPointAwarded;
+	}
+}
+
+void ULevelUpInfo::PostLoad()
+{
+	Super::PostLoad();
+
+	BuildProgressionTables();
+}
+
+#if WITH_EDITOR
+void ULevelUpInfo::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BuildProgressionTables();
 }
+#endif
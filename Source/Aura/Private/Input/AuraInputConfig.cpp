@@ -5,12 +5,9 @@
 
 const UInputAction* UAuraInputConfig::FindAbilityInputActionForTag(const FGameplayTag& Tag, bool bLogNotFound) const
 {
-	for (const FAuraInputAction& Action : AbilityInputActions)
+	if(const FAuraInputAction* Action = InputActionIndex.Find(AbilityInputActions, Tag))
 	{
-		if (Action.InputAction && Action.InputTag.MatchesTag(Tag))
-		{
-			return Action.InputAction;
-		}
+		return Action->InputAction;
 	}
 
 	if(bLogNotFound)
@@ -20,3 +17,28 @@ const UInputAction* UAuraInputConfig::FindAbilityInputActionForTag(const FGamepl
 	
 	return nullptr;
 }
+
+void UAuraInputConfig::PostLoad()
+{
+	Super::PostLoad();
+
+	BuildInputActionIndex();
+}
+
+#if WITH_EDITOR
+void UAuraInputConfig::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BuildInputActionIndex();
+}
+#endif
+
+void UAuraInputConfig::BuildInputActionIndex()
+{
+	// Entries without an action are skipped so a later entry with the same tag can still be found
+	InputActionIndex.Build(AbilityInputActions, [](const FAuraInputAction& Action)
+	{
+		return Action.InputAction ? Action.InputTag : FGameplayTag();
+	});
+}
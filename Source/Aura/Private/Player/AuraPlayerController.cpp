@@ -7,20 +7,26 @@
 #include "AuraGameplayTags.h"
 #include "EnhancedInputSubsystems.h"
 #include "GameplayTagContainer.h"
-#include "NavigationPath.h"
-#include "NavigationSystem.h"
 #include "NiagaraFunctionLibrary.h"
 #include "AbilitySystem/AuraAbilitySystemComponent.h"
+#include "Components/AuraCameraOcclusionComponent.h"
+#include "Components/AuraCursorHitComponent.h"
+#include "Components/AuraPathRequestComponent.h"
 #include "Components/SplineComponent.h"
 #include "GameFramework/Character.h"
 #include "Input/AuraInputComponent.h"
+#include "Aura/AuraStats.h"
 #include "Interaction/EnemyInterface.h"
+#include "UI/HUD/AuraDamageNumberSubsystem.h"
 #include "UI/Widget/DamageTextComponent.h"
 
 AAuraPlayerController::AAuraPlayerController()
 {
 	bReplicates = true;
 	Spline = CreateDefaultSubobject<USplineComponent>("Spline");
+	CameraOcclusion = CreateDefaultSubobject<UAuraCameraOcclusionComponent>("CameraOcclusion");
+	CursorHits = CreateDefaultSubobject<UAuraCursorHitComponent>("CursorHits");
+	PathRequests = CreateDefaultSubobject<UAuraPathRequestComponent>("PathRequests");
 }
 
 void AAuraPlayerController::PlayerTick(float DeltaTime)
@@ -32,8 +38,14 @@ void AAuraPlayerController::PlayerTick(float DeltaTime)
 
 void AAuraPlayerController::ShowDamageNumber_Implementation(float DamageAmount, ACharacter* TargetCharacter, bool bBlockedHit, bool bCriticalHit)
 {
-	if(IsValid(TargetCharacter) && DamageTextComponentClass && IsLocalController())
+	if(!IsValid(TargetCharacter) || !IsLocalController()) return;
+
+	UAuraDamageNumberSubsystem* DamageNumbers = UAuraDamageNumberSubsystem::Get(this);
+	if(DamageNumbers && DamageNumbers->Add(TargetCharacter, DamageAmount, bBlockedHit, bCriticalHit)) return;
+
+	if(DamageTextComponentClass)
 	{
+		SCOPE_CYCLE_COUNTER(STAT_Aura_DamageNumberSpawn);
 		UDamageTextComponent* DamageText = NewObject<UDamageTextComponent>(TargetCharacter, DamageTextComponentClass);
 		DamageText->RegisterComponent();
 		DamageText->AttachToComponent(TargetCharacter->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
@@ -59,6 +71,15 @@ void AAuraPlayerController::AutoRun()
 	}
 }
 
+void AAuraPlayerController::FollowPath(const TArray<FVector>& PathPoints)
+{
+	if(PathPoints.Num() == 0) return;
+
+	Spline->SetSplinePoints(PathPoints, ESplineCoordinateSpace::World, true);
+	CachedDestination = PathPoints.Last();
+	bAutoRunning = true;
+}
+
 void AAuraPlayerController::CursorTrace()
 {
 	if(GetAuraAbilitySystemComponent() && GetAuraAbilitySystemComponent()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_CursorTrace))
@@ -69,7 +90,8 @@ void AAuraPlayerController::CursorTrace()
 		ThisActor = nullptr;
 		return;	
 	}
-	GetHitResultUnderCursor(ECC_Visibility, false, CursorHit);
+	CursorHits->UpdateTraces();
+	CursorHit = CursorHits->GetHitResult(ECC_Visibility);
 	if(!CursorHit.bBlockingHit) return;
 
 	LastActor = ThisActor;
@@ -91,7 +113,8 @@ void AAuraPlayerController::AbilityInputTagPressed(FGameplayTag InputTag)
 	if(InputTag.MatchesTagExact(FAuraGameplayTags::Get().InputTag_LMB))
 	{
 		bTargeting = ThisActor ? true : false;
-		bAutoRunning = false;	
+		bAutoRunning = false;
+		PathRequests->CancelRequest();
 	}
 	if(GetAuraAbilitySystemComponent())
 	{
@@ -124,19 +147,7 @@ void AAuraPlayerController::AbilityInputTagReleased(FGameplayTag InputTag)
 		const APawn* ControlledPawn = GetPawn<APawn>();
 		if(FollowTime < ShortPressThreshold && ControlledPawn)
 		{
-			if(UNavigationPath* NavPath = UNavigationSystemV1::FindPathToLocationSynchronously(this, ControlledPawn->GetActorLocation(), CachedDestination))
-			{
-				Spline->ClearSplinePoints();
-				for(const FVector& PointLoc : NavPath->PathPoints)
-				{
-					Spline->AddSplinePoint(PointLoc, ESplineCoordinateSpace::World);
-				}
-				if(NavPath->PathPoints.Num() > 0)
-				{
-					CachedDestination = NavPath->PathPoints.Last();
-					bAutoRunning = true;
-				}
-			}
+			PathRequests->RequestPath(CachedDestination, FAuraPathReadyDelegate::CreateUObject(this, &AAuraPlayerController::FollowPath));
 			if(GetAuraAbilitySystemComponent() && !GetAuraAbilitySystemComponent()->HasMatchingGameplayTag(FAuraGameplayTags::Get().Player_Block_InputPressed))
 			{
 				UNiagaraFunctionLibrary::SpawnSystemAtLocation(this, ClickNiagaraSystem, CachedDestination);
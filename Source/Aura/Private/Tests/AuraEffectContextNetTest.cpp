@@ -0,0 +1,128 @@
+// Copyright Axchemy Games
+
+
+#include "AuraAbilityTypes.h"
+#include "AuraGameplayTags.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/CoreNet.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace AuraEffectContextNetTest
+{
+	struct FRoundTripCase
+	{
+		const TCHAR* Name;
+		FAuraGameplayEffectContext Context;
+
+		// What the client should read back, the same as Context unless quantization changes a value
+		FAuraGameplayEffectContext Expected;
+
+		// Part of the ensure the write has to raise, for values the wire can't carry
+		const TCHAR* ExpectedError = nullptr;
+	};
+
+	static TArray<FRoundTripCase> MakeCases()
+	{
+		const FAuraGameplayTags& GameplayTags = FAuraGameplayTags::Get();
+
+		TArray<FRoundTripCase> Cases;
+
+		FRoundTripCase& Plain = Cases.Add_GetRef({ TEXT("plain hit") });
+		Plain.Context.SetDamageType(GameplayTags.Damage_Fire);
+
+		FRoundTripCase& Critical = Cases.Add_GetRef({ TEXT("critical + knockback") });
+		Critical.Context.SetIsCriticalHit(true);
+		Critical.Context.SetDamageType(GameplayTags.Damage_Physical);
+		Critical.Context.SetKnockBackForce(FVector(707.1f, -707.1f, 1000.f));
+
+		FRoundTripCase& Debuff = Cases.Add_GetRef({ TEXT("debuff + death impulse") });
+		Debuff.Context.SetIsSuccessfulDebuff(true);
+		Debuff.Context.SetDebuffDamage(5.f);
+		Debuff.Context.SetDebuffDuration(5.f);
+		Debuff.Context.SetDebuffFrequency(1.f);
+		Debuff.Context.SetDamageType(GameplayTags.Damage_Lightning);
+		Debuff.Context.SetDeathImpulse(FVector(3535.53f, 3535.53f, 5000.f));
+
+		FRoundTripCase& Blocked = Cases.Add_GetRef({ TEXT("blocked, non-table damage type") });
+		Blocked.Context.SetIsBlockedHit(true);
+		Blocked.Context.SetDamageType(GameplayTags.Damage);
+
+		for(FRoundTripCase& Case : Cases)
+		{
+			Case.Expected = Case.Context;
+		}
+
+		// Below one tenth still arrives as a debuff, everything else rounds to the nearest tenth
+		FRoundTripCase& SmallDebuff = Cases.Add_GetRef({ TEXT("debuff below one tenth") });
+		SmallDebuff.Context.SetIsSuccessfulDebuff(true);
+		SmallDebuff.Context.SetDebuffDamage(0.01f);
+		SmallDebuff.Context.SetDebuffDuration(0.04f);
+		SmallDebuff.Context.SetDebuffFrequency(0.26f);
+		SmallDebuff.Expected = SmallDebuff.Context;
+		SmallDebuff.Expected.SetDebuffDamage(0.1f);
+		SmallDebuff.Expected.SetDebuffDuration(0.1f);
+		SmallDebuff.Expected.SetDebuffFrequency(0.3f);
+
+		FRoundTripCase& NegativeDebuff = Cases.Add_GetRef({ TEXT("negative debuff") });
+		NegativeDebuff.Context.SetIsSuccessfulDebuff(true);
+		NegativeDebuff.Context.SetDebuffDamage(-2.f);
+		NegativeDebuff.Context.SetDebuffDuration(5.f);
+		NegativeDebuff.Expected = NegativeDebuff.Context;
+		NegativeDebuff.Expected.SetDebuffDamage(0.f);
+		NegativeDebuff.ExpectedError = TEXT("Debuff value -2.000000 is outside");
+
+		FRoundTripCase& HugeDebuff = Cases.Add_GetRef({ TEXT("debuff above range") });
+		HugeDebuff.Context.SetIsSuccessfulDebuff(true);
+		HugeDebuff.Context.SetDebuffDuration(2000000.f);
+		HugeDebuff.Expected = HugeDebuff.Context;
+		HugeDebuff.Expected.SetDebuffDuration(1000000.f);
+		HugeDebuff.ExpectedError = TEXT("Debuff value 2000000.000000 is outside");
+
+		return Cases;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAuraEffectContextNetSerializeTest, "Aura.Net.EffectContext.RoundTrip",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAuraEffectContextNetSerializeTest::RunTest(const FString& Parameters)
+{
+	for(AuraEffectContextNetTest::FRoundTripCase& Case : AuraEffectContextNetTest::MakeCases())
+	{
+		if(Case.ExpectedError)
+		{
+			AddExpectedError(Case.ExpectedError, EAutomationExpectedErrorFlags::Contains, 0);
+		}
+
+		FNetBitWriter Writer(nullptr, 1024);
+		bool bWriteSuccess = true;
+		Case.Context.NetSerialize(Writer, nullptr, bWriteSuccess);
+
+		FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+		FAuraGameplayEffectContext Read;
+		bool bReadSuccess = true;
+		Read.NetSerialize(Reader, nullptr, bReadSuccess);
+
+		const FAuraGameplayEffectContext& Expected = Case.Expected;
+		const FString What(Case.Name);
+		TestTrue(What + TEXT(" writes"), bWriteSuccess && !Writer.IsError());
+		TestTrue(What + TEXT(" reads"), bReadSuccess && !Reader.IsError());
+		TestEqual(What + TEXT(" reads every bit written"), Reader.GetPosBits(), Writer.GetNumBits());
+
+		TestEqual(What + TEXT(" BlockedHit"), Read.IsBlockedHit(), Expected.IsBlockedHit());
+		TestEqual(What + TEXT(" CriticalHit"), Read.IsCriticalHit(), Expected.IsCriticalHit());
+		TestEqual(What + TEXT(" SuccessfulDebuff"), Read.IsSuccessfulDebuff(), Expected.IsSuccessfulDebuff());
+
+		// Debuff values go in tenths, impulses with NetQuantize10 precision
+		TestEqual(What + TEXT(" DebuffDamage"), Read.GetDebuffDamage(), Expected.GetDebuffDamage(), 0.05f);
+		TestEqual(What + TEXT(" DebuffDuration"), Read.GetDebuffDuration(), Expected.GetDebuffDuration(), 0.05f);
+		TestEqual(What + TEXT(" DebuffFrequency"), Read.GetDebuffFrequency(), Expected.GetDebuffFrequency(), 0.05f);
+		TestEqual(What + TEXT(" DamageType"), Read.GetDamageType().ToString(), Expected.GetDamageType().ToString());
+		TestEqual(What + TEXT(" DeathImpulse"), Read.GetDeathImpulse(), Expected.GetDeathImpulse(), 0.1f);
+		TestEqual(What + TEXT(" KnockBackForce"), Read.GetKnockBackForce(), Expected.GetKnockBackForce(), 0.1f);
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,125 @@
+// Copyright Axchemy Games
+
+
+#include "UI/HUD/AuraDamageNumberSubsystem.h"
+
+#include "Aura/AuraStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+static TAutoConsoleVariable<bool> CVarAuraDamageNumbersBatched(
+	TEXT("Aura.DamageNumbers.Batched"),
+	false,
+	TEXT("1 draws damage numbers as plain canvas text from the HUD, for stress tests with many hits. 0 spawns the designed DamageTextComponent widget per hit."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarAuraDamageNumbersMax(
+	TEXT("Aura.DamageNumbers.Max"),
+	64,
+	TEXT("Most damage numbers on screen at once, the oldest is dropped to make room."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarAuraDamageNumbersLifetime(
+	TEXT("Aura.DamageNumbers.Lifetime"),
+	1.f,
+	TEXT("Seconds a damage number stays on screen."),
+	ECVF_Default);
+
+UAuraDamageNumberSubsystem* UAuraDamageNumberSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UAuraDamageNumberSubsystem>() : nullptr;
+}
+
+bool UAuraDamageNumberSubsystem::Add(const AActor* Target, float Damage, bool bBlockedHit, bool bCriticalHit)
+{
+	if(!CVarAuraDamageNumbersBatched.GetValueOnGameThread()) return false;
+	if(Target == nullptr) return true;
+
+	SCOPE_CYCLE_COUNTER(STAT_Aura_DamageNumberSpawn);
+
+	// DoT ticks and area hits often land on one target several times in a frame, show them as one number
+	for(int32 i = Numbers.Num() - 1; i >= 0 && Numbers[i].Frame == GFrameCounter; i--)
+	{
+		FAuraDamageNumber& Number = Numbers[i];
+		if(Number.Target == Target)
+		{
+			Number.Damage += Damage;
+			Number.bBlockedHit |= bBlockedHit;
+			Number.bCriticalHit |= bCriticalHit;
+			FormatText(Number);
+			INC_DWORD_STAT(STAT_Aura_DamageNumbersCoalesced);
+			return true;
+		}
+	}
+
+	const int32 MaxNumbers = FMath::Max(CVarAuraDamageNumbersMax.GetValueOnGameThread(), 1);
+	if(Numbers.Num() >= MaxNumbers)
+	{
+		const int32 NumEvicted = Numbers.Num() - MaxNumbers + 1;
+		Numbers.RemoveAt(0, NumEvicted, EAllowShrinking::No);
+		INC_DWORD_STAT_BY(STAT_Aura_DamageNumbersEvicted, NumEvicted);
+	}
+
+	FAuraDamageNumber& Number = Numbers.AddDefaulted_GetRef();
+	Number.Location = Target->GetActorLocation();
+	Number.Target = Target;
+	Number.Damage = Damage;
+	Number.Frame = GFrameCounter;
+	Number.Serial = NextSerial++;
+	Number.bBlockedHit = bBlockedHit;
+	Number.bCriticalHit = bCriticalHit;
+	FormatText(Number);
+	return true;
+}
+
+void UAuraDamageNumberSubsystem::FormatText(FAuraDamageNumber& Number)
+{
+	Number.Text.Reset();
+	Number.Text.AppendInt(FMath::RoundToInt32(Number.Damage));
+}
+
+float UAuraDamageNumberSubsystem::GetLifetime() const
+{
+	return FMath::Max(CVarAuraDamageNumbersLifetime.GetValueOnGameThread(), UE_KINDA_SMALL_NUMBER);
+}
+
+void UAuraDamageNumberSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	for(FAuraDamageNumber& Number : Numbers)
+	{
+		Number.Age += DeltaTime;
+	}
+
+	// Numbers are kept in spawn order, the expired ones are all at the front
+	const float Lifetime = GetLifetime();
+	int32 NumExpired = 0;
+	while(NumExpired < Numbers.Num() && Numbers[NumExpired].Age >= Lifetime)
+	{
+		NumExpired++;
+	}
+	Numbers.RemoveAt(0, NumExpired, EAllowShrinking::No);
+
+	SET_DWORD_STAT(STAT_Aura_DamageNumbersLive, Numbers.Num());
+}
+
+TStatId UAuraDamageNumberSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAuraDamageNumberSubsystem, STATGROUP_Tickables);
+}
+
+void UAuraDamageNumberSubsystem::Deinitialize()
+{
+	Numbers.Empty();
+	SET_DWORD_STAT(STAT_Aura_DamageNumbersLive, 0);
+
+	Super::Deinitialize();
+}
+
+bool UAuraDamageNumberSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -3,6 +3,11 @@
 
 #include "UI/HUD/AuraHUD.h"
 
+#include "Aura/AuraStats.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/Font.h"
+#include "UI/HUD/AuraDamageNumberSubsystem.h"
 #include "UI/Widget/AuraUserWidget.h"
 #include "UI/WidgetController/AttributeMenuWidgetController.h"
 #include "UI/WidgetController/OverlayWidgetController.h"
@@ -56,3 +61,45 @@ void AAuraHUD::InitOverlay(APlayerController* PC, APlayerState* PS, UAbilitySyst
 	WidgetController->BroadcastInitialValues();
 	Widget->AddToViewport();
 }
+
+void AAuraHUD::DrawHUD()
+{
+	Super::DrawHUD();
+	DrawDamageNumbers();
+}
+
+void AAuraHUD::DrawDamageNumbers()
+{
+	const UAuraDamageNumberSubsystem* DamageNumbers = UAuraDamageNumberSubsystem::Get(this);
+	if(DamageNumbers == nullptr || DamageNumbers->GetNumbers().Num() == 0 || PlayerOwner == nullptr) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_Aura_DamageNumberDraw);
+
+	UFont* Font = DamageNumberStyle.Font ? DamageNumberStyle.Font.Get() : GEngine->GetLargeFont();
+	const float Lifetime = DamageNumbers->GetLifetime();
+
+	for(const FAuraDamageNumber& Number : DamageNumbers->GetNumbers())
+	{
+		const float Progress = FMath::Clamp(Number.Age / Lifetime, 0.f, 1.f);
+		const FVector WorldLocation = Number.Location + DamageNumberStyle.AnchorOffset + FVector(0.f, 0.f, DamageNumberStyle.RiseDistance * Progress);
+
+		FVector2D ScreenLocation;
+		if(!PlayerOwner->ProjectWorldLocationToScreen(WorldLocation, ScreenLocation, true)) continue;
+
+		// Cycles through five columns so numbers from consecutive hits sit side by side
+		ScreenLocation.X += (static_cast<int32>(Number.Serial % 5) - 2) * DamageNumberStyle.HorizontalSpread;
+
+		FLinearColor Color = Number.bCriticalHit ? DamageNumberStyle.CriticalHitColor : Number.bBlockedHit ? DamageNumberStyle.BlockedHitColor : DamageNumberStyle.Color;
+		Color.A *= 1.f - Progress * Progress;
+
+		// Critical hits pop in large and settle back to the critical scale
+		const float Scale = Number.bCriticalHit
+			? DamageNumberStyle.CriticalHitScale * (1.f + 0.5f * FMath::Max(0.f, 1.f - Progress * 5.f))
+			: DamageNumberStyle.Scale;
+
+		float Width = 0.f;
+		float Height = 0.f;
+		GetTextSize(Number.Text, Width, Height, Font, Scale);
+		DrawText(Number.Text, Color, ScreenLocation.X - Width * 0.5f, ScreenLocation.Y - Height * 0.5f, Font, Scale);
+	}
+}
@@ -3,3 +3,17 @@
 
 #include "UI/Widget/DamageTextComponent.h"
 
+#include "Aura/AuraStats.h"
+
+void UDamageTextComponent::OnRegister()
+{
+	Super::OnRegister();
+	INC_DWORD_STAT(STAT_Aura_DamageTextComponentsLive);
+}
+
+void UDamageTextComponent::OnUnregister()
+{
+	DEC_DWORD_STAT(STAT_Aura_DamageTextComponentsLive);
+	Super::OnUnregister();
+}
+
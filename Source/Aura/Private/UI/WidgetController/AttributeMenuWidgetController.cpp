@@ -48,7 +48,10 @@ void UAttributeMenuWidgetController::UpgradeAttribute(const FGameplayTag& Attrib
 
 void UAttributeMenuWidgetController::BroadcastAttributeInfo(const FGameplayTag& Tag) const
 {
-	FAuraAttributeInfo Info = AttributeInfo->FindAttributeInfoForTag(Tag);
-	Info.AttributeValue = Info.AttributeGetter.GetNumericValue(AttributeSet);
-	AttributeInfoDelegate.Broadcast(Info);
+	if(const FAuraAttributeInfo* FoundInfo = AttributeInfo->GetAttributeInfoForTag(Tag))
+	{
+		FAuraAttributeInfo Info = *FoundInfo;
+		Info.AttributeValue = Info.AttributeGetter.GetNumericValue(AttributeSet);
+		AttributeInfoDelegate.Broadcast(Info);
+	}
 }
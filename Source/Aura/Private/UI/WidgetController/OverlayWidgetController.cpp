@@ -120,7 +120,7 @@ void UOverlayWidgetController::OnAbilityEquipped(const FGameplayTag& AbilityTag,
 	// broadcast empty info if PreviousSlot is a valid. Only if equipping on already-equipped spell
 	AbilityInfoDelegate.Broadcast(LastSlotInfo);
 
-	FAuraAbilityInfo Info = AbilityInfo->FindAbilityInfoForTag(AbilityTag);
+	FAuraAbilityInfo Info = AbilityInfo->GetAbilityInfoForTag(AbilityTag);
 	Info.StatusTag = Status;
 	Info.InputTag = Slot;
 	AbilityInfoDelegate.Broadcast(Info);
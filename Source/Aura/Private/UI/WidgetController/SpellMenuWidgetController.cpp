@@ -34,7 +34,7 @@ void USpellMenuWidgetController::BindCallbackToDependencies()
 			
 			if(AbilityInfo)
 			{
-				FAuraAbilityInfo Info = AbilityInfo->FindAbilityInfoForTag(AbilityTag);
+				FAuraAbilityInfo Info = AbilityInfo->GetAbilityInfoForTag(AbilityTag);
 				Info.StatusTag = StatusTag;
 				AbilityInfoDelegate.Broadcast(Info);
 			}
@@ -64,7 +64,7 @@ void USpellMenuWidgetController::SpellGlobeSelected(const FGameplayTag& AbilityT
 {
 	if(bWaitingForEquipSelection)
 	{
-		const FGameplayTag SelectedAbilityType = AbilityInfo->FindAbilityInfoForTag(AbilityTag).AbilityType;
+		const FGameplayTag SelectedAbilityType = AbilityInfo->GetAbilityInfoForTag(AbilityTag).AbilityType;
 		StopWaitingForEquipDelegate.Broadcast(SelectedAbilityType);
 		bWaitingForEquipSelection = false;
 	}
@@ -110,7 +110,7 @@ void USpellMenuWidgetController::GlobeDeselect()
 {
 	if(bWaitingForEquipSelection)
 	{
-		const FGameplayTag SelectedAbilityType = AbilityInfo->FindAbilityInfoForTag(SelectedAbility.Ability).AbilityType;
+		const FGameplayTag SelectedAbilityType = AbilityInfo->GetAbilityInfoForTag(SelectedAbility.Ability).AbilityType;
 		StopWaitingForEquipDelegate.Broadcast(SelectedAbilityType);
 		bWaitingForEquipSelection = false;
 	}
@@ -123,7 +123,7 @@ void USpellMenuWidgetController::GlobeDeselect()
 
 void USpellMenuWidgetController::EquipButtonPressed()
 {
-	const FGameplayTag AbilityType = AbilityInfo->FindAbilityInfoForTag(SelectedAbility.Ability).AbilityType;
+	const FGameplayTag AbilityType = AbilityInfo->GetAbilityInfoForTag(SelectedAbility.Ability).AbilityType;
 	WaitForEquipSelectionDelegate.Broadcast(AbilityType);
 	bWaitingForEquipSelection = true;
 
@@ -139,7 +139,7 @@ void USpellMenuWidgetController::SpellRowGlobePressed(const FGameplayTag& SlotTa
 	if(!bWaitingForEquipSelection) return;
 	// check selected ability against the slot's ability type.
 	// (don't equip an offensive ability in a passive slot and vice versa)
-	const FGameplayTag& SelectedAbilityType = AbilityInfo->FindAbilityInfoForTag(SelectedAbility.Ability).AbilityType;
+	const FGameplayTag& SelectedAbilityType = AbilityInfo->GetAbilityInfoForTag(SelectedAbility.Ability).AbilityType;
 	if(!SelectedAbilityType.MatchesTagExact(AbilityType)) return;
 
 	GetAuraAbilitySystemComponent()->ServerEquipAbility(SelectedAbility.Ability, SlotTag);
@@ -159,12 +159,12 @@ void USpellMenuWidgetController::OnAbilityEquipped(const FGameplayTag& AbilityTa
 	// broadcast empty info if PreviousSlot is a valid. Only if equipping on already-equipped spell
 	AbilityInfoDelegate.Broadcast(LastSlotInfo);
 
-	FAuraAbilityInfo Info = AbilityInfo->FindAbilityInfoForTag(AbilityTag);
+	FAuraAbilityInfo Info = AbilityInfo->GetAbilityInfoForTag(AbilityTag);
 	Info.StatusTag = Status;
 	Info.InputTag = Slot;
 	AbilityInfoDelegate.Broadcast(Info);
 
-	StopWaitingForEquipDelegate.Broadcast(AbilityInfo->FindAbilityInfoForTag(AbilityTag).AbilityType);
+	StopWaitingForEquipDelegate.Broadcast(AbilityInfo->GetAbilityInfoForTag(AbilityTag).AbilityType);
 	SpellGlobeReassignedDelegate.Broadcast(AbilityTag);
 	GlobeDeselect();
 }
@@ -0,0 +1,65 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AI/AuraBehaviorTreeComponent.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraAISignificanceManager.generated.h"
+
+/**
+ * Buckets AI agents by distance to the nearest player and whether they are on screen, and hands each bucket
+ * its behavior tree tick budget and service interval (Aura.AI.Significance.* CVars).
+ * Agents are re-evaluated round robin, as many per frame as fit in Aura.AI.Significance.BudgetMs.
+ */
+UCLASS()
+class AURA_API UAuraAISignificanceManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UAuraAISignificanceManager* Get(const UObject* WorldContextObject);
+
+	void RegisterAgent(UAuraBehaviorTreeComponent* Agent);
+	void UnregisterAgent(UAuraBehaviorTreeComponent* Agent);
+
+	int32 GetNumAgents(EAuraAISignificance Significance) const { return BucketCounts[static_cast<int32>(Significance)]; }
+
+	/** UTickableWorldSubsystem */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/** end UTickableWorldSubsystem */
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	struct FAgent
+	{
+		TWeakObjectPtr<UAuraBehaviorTreeComponent> Component;
+		EAuraAISignificance Significance = EAuraAISignificance::Critical;
+	};
+
+	struct FBucketSettings
+	{
+		float TickInterval = 0.f;
+		float ServiceInterval = 0.f;
+	};
+
+	/** Re-reads the bucket CVars and pushes any change to every agent */
+	void RefreshSettings();
+
+	EAuraAISignificance Evaluate(const APawn* Pawn) const;
+	void RemoveAgentAt(int32 Index);
+
+	TArray<FAgent> Agents;
+	int32 NextAgent = 0;
+
+	FBucketSettings Buckets[static_cast<int32>(EAuraAISignificance::MAX)];
+	int32 BucketCounts[static_cast<int32>(EAuraAISignificance::MAX)] = {};
+	FString CachedTickIntervals;
+	FString CachedServiceIntervals;
+};
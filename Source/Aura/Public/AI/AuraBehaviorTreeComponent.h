@@ -0,0 +1,50 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+#include "AuraBehaviorTreeComponent.generated.h"
+
+enum class EAuraAISignificance : uint8
+{
+	Critical,
+	Near,
+	Far,
+	Dormant,
+	MAX
+};
+
+/**
+ * Behavior tree component with a per-agent update budget set by UAuraAISignificanceManager.
+ * Ticks closer together than MinTickInterval are folded into the next one, so a far agent runs its tree
+ * a few times a second with the combined delta instead of every frame.
+ */
+UCLASS()
+class AURA_API UAuraBehaviorTreeComponent : public UBehaviorTreeComponent
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	void SetSignificance(EAuraAISignificance InSignificance, float InMinTickInterval, float InServiceInterval);
+
+	EAuraAISignificance GetSignificance() const { return Significance; }
+
+	/** Interval for services that follow the budget, 0 keeps the node's own interval */
+	float GetServiceInterval() const { return ServiceInterval; }
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+
+	EAuraAISignificance Significance = EAuraAISignificance::Critical;
+	float MinTickInterval = 0.f;
+	float ServiceInterval = 0.f;
+	float SkippedDeltaTime = 0.f;
+};
@@ -57,6 +57,9 @@ public:
 	void MulticastActivatePassiveEffect(const FGameplayTag& AbilityTag, bool bActivate);
 	
 	FGameplayAbilitySpec* GetSpecFromAbilityTag(const FGameplayTag& AbilityTag);
+
+	/** Level of the given passive ability, or 0 if it hasn't been given. Kept up to date as passives are given, removed and levelled. */
+	int32 GetPassiveAbilityLevel(const FGameplayTag& PassiveAbilityTag) const;
 	
 	void UpgradeAttribute(const FGameplayTag& AttributeTag);
 
@@ -81,6 +84,8 @@ public:
 	static bool AbilityHasSlot(FGameplayAbilitySpec* Spec, const FGameplayTag& Slot);
 protected:
 
+	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
 	virtual void OnRep_ActivateAbilities() override;
 	
 	UFUNCTION(Client, Reliable)
@@ -88,4 +93,33 @@ protected:
 
 	UFUNCTION(Client, Reliable) 
 	void ClientUpdateAbilityStatus(const FGameplayTag& AbilityTag, const FGameplayTag& StatusTag, int32 AbilityLevel);
+
+private:
+
+	void UpdatePassiveAbilityLevel(const FGameplayAbilitySpec& AbilitySpec, bool bRemoved = false);
+
+	TMap<FGameplayTag, int32> PassiveAbilityLevels;
+
+	/** Tags a spec is currently filed under, so it can be taken out of the lookups when it changes or is removed */
+	struct FAbilitySpecIndexEntry
+	{
+		TArray<FGameplayTag, TInlineAllocator<2>> AbilityTags;
+		FGameplayTag InputTag;
+		FGameplayTag StatusTag;
+		int32 SpecIndex = INDEX_NONE;
+	};
+
+	/** (Re)files the spec under its current ability, input and status tags. Call after changing a spec's dynamic tags. */
+	void IndexAbilitySpec(const FGameplayAbilitySpec& AbilitySpec, int32 SpecIndex = INDEX_NONE);
+	void UnindexAbilitySpec(const FGameplayAbilitySpecHandle& Handle);
+	void RebuildAbilitySpecIndex();
+
+	/** Clients only learn about slot, status and level changes from OnRep_ActivateAbilities, which marks the index dirty */
+	void ConditionalRebuildAbilitySpecIndex();
+	bool bAbilitySpecIndexDirty = false;
+	FGameplayAbilitySpec* FindIndexedSpec(const FGameplayAbilitySpecHandle& Handle);
+
+	TMap<FGameplayAbilitySpecHandle, FAbilitySpecIndexEntry> AbilitySpecIndex;
+	TMap<FGameplayTag, FGameplayAbilitySpecHandle> AbilityTagToHandle;
+	TMap<FGameplayTag, FGameplayAbilitySpecHandle> InputTagToHandle;
 };
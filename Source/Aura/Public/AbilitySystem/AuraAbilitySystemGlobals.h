@@ -4,8 +4,18 @@
 
 #include "CoreMinimal.h"
 #include "AbilitySystemGlobals.h"
+#include "AuraGameplayTags.h"
 #include "AuraAbilitySystemGlobals.generated.h"
 
+class UGameplayEffect;
+
+enum class EAuraSiphonType : uint8
+{
+	Life,
+	Mana,
+	MAX
+};
+
 /**
  * 
  */
@@ -14,4 +24,36 @@ class AURA_API UAuraAbilitySystemGlobals : public UAbilitySystemGlobals
 {
 	GENERATED_BODY()
 	virtual FGameplayEffectContext* AllocGameplayEffectContext() const override;
+
+public:
+
+	static UAuraAbilitySystemGlobals& Get() { return *CastChecked<UAuraAbilitySystemGlobals>(&UAbilitySystemGlobals::Get()); }
+
+	/** Builds the effects that used to be created at runtime. Needs the native gameplay tags, safe to call more than once. */
+	void InitRuntimeEffects();
+
+	/** Debuff effect for a damage type. Damage, duration and period are passed per hit (see UAuraAttributeSet::Debuff). */
+	const UGameplayEffect* GetDebuffEffect(EAuraDamageType DamageType) const
+	{
+		const int32 Index = static_cast<int32>(DamageType);
+		return DebuffEffects.IsValidIndex(Index) ? DebuffEffects[Index].Get() : nullptr;
+	}
+
+	/** Instant siphon effect. The amount is passed as a SetByCaller magnitude keyed by the siphon's passive ability tag. */
+	const UGameplayEffect* GetSiphonEffect(EAuraSiphonType SiphonType) const
+	{
+		const int32 Index = static_cast<int32>(SiphonType);
+		return SiphonEffects.IsValidIndex(Index) ? SiphonEffects[Index].Get() : nullptr;
+	}
+
+private:
+
+	UGameplayEffect* MakeDebuffEffect(const FAuraDamageTypeTags& DamageTypeTags);
+	UGameplayEffect* MakeSiphonEffect(const FName& EffectName, const FGameplayAttribute& Attribute, const FGameplayTag& MagnitudeTag);
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UGameplayEffect>> DebuffEffects;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UGameplayEffect>> SiphonEffects;
 };
@@ -61,13 +61,13 @@ public:
 	static bool IsSuccessfulDebuff(const FGameplayEffectContextHandle& EffectContextHandle);
 
 	UFUNCTION(BlueprintPure, Category= "Aura Ability System Library|Gameplay Effects")
-	static FScalableFloat GetDebuffDamage(const FGameplayEffectContextHandle& EffectContextHandle);
+	static float GetDebuffDamage(const FGameplayEffectContextHandle& EffectContextHandle);
 
 	UFUNCTION(BlueprintPure, Category= "Aura Ability System Library|Gameplay Effects")
-	static FScalableFloat GetDebuffDuration(const FGameplayEffectContextHandle& EffectContextHandle);
+	static float GetDebuffDuration(const FGameplayEffectContextHandle& EffectContextHandle);
 
 	UFUNCTION(BlueprintPure, Category= "Aura Ability System Library|Gameplay Effects")
-	static FScalableFloat GetDebuffFrequency(const FGameplayEffectContextHandle& EffectContextHandle);
+	static float GetDebuffFrequency(const FGameplayEffectContextHandle& EffectContextHandle);
 
 	UFUNCTION(BlueprintPure, Category= "Aura Ability System Library|Gameplay Effects")
 	static FGameplayTag GetDamageType(const FGameplayEffectContextHandle& EffectContextHandle);
@@ -88,13 +88,13 @@ public:
 	static void SetIsSuccessfulDebuff(UPARAM(ref) FGameplayEffectContextHandle& EffectContextHandle, bool bIsSuccessfulDebuff);
 
 	UFUNCTION(BlueprintCallable, Category= "Aura Ability System Library|Gameplay Effects")
-	static void SetDebuffDamage(UPARAM(ref) FGameplayEffectContextHandle& EffectContextHandle, FScalableFloat InDebuffDamage);
+	static void SetDebuffDamage(UPARAM(ref) FGameplayEffectContextHandle& EffectContextHandle, float InDebuffDamage);
 
 	UFUNCTION(BlueprintCallable, Category= "Aura Ability System Library|Gameplay Effects")
-	static void SetDebuffDuration(UPARAM(ref) FGameplayEffectContextHandle& EffectContextHandle, FScalableFloat InDebuffDuration);
+	static void SetDebuffDuration(UPARAM(ref) FGameplayEffectContextHandle& EffectContextHandle, float InDebuffDuration);
 
 	UFUNCTION(BlueprintCallable, Category= "Aura Ability System Library|Gameplay Effects")
-	static void SetDebuffFrequency(UPARAM(ref) FGameplayEffectContextHandle& EffectContextHandle, FScalableFloat InDebuffFrequency);
+	static void SetDebuffFrequency(UPARAM(ref) FGameplayEffectContextHandle& EffectContextHandle, float InDebuffFrequency);
 
 	UFUNCTION(BlueprintCallable, Category= "Aura Ability System Library|Gameplay Effects")
 	static void SetDamageType(UPARAM(ref) FGameplayEffectContextHandle& EffectContextHandle, FGameplayTag InDamageType);
@@ -110,6 +110,12 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category= "Aura Ability System Library|Gameplay Mechanics")
 	static void GetClosestTargets(int32 MaxTargets, const TArray<AActor*>& Actors, TArray<AActor*>& OutClosestTargets, FVector Origin);
+
+	/**
+	 * Writes the indices of the K locations closest to Origin into OutIndices, nearest first.
+	 * Equal distances keep their input order. Squared distances are computed once, then partially selected.
+	 */
+	static void FindClosestIndices(TConstArrayView<FVector> Locations, const FVector& Origin, int32 K, TArray<int32>& OutIndices);
 	
 	UFUNCTION(BlueprintPure, Category= "Aura Ability System Library|Gameplay Mechanics")
 	static bool IsNotFriend(const AActor* FirstActor, const AActor* SecondActor);
@@ -117,6 +123,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category= "Aura Ability System Library|Damage Effect")
 	static FGameplayEffectContextHandle ApplyDamageEffect(const FDamageEffectParams& DamageEffectParams);
 
+	/** Applies DamageEffectParams to every target, building each damage type's spec once. Only the death impulse and knockback are made per target. */
+	static void ApplyDamageEffectBatch(const FDamageEffectParams& DamageEffectParams, TArrayView<UAbilitySystemComponent*> TargetAbilitySystemComponents);
+
 	UFUNCTION(BlueprintCallable, Category= "Aura Ability System Library|Gameplay Mechanics")
 	static TArray<FRotator> EvenlySpacedRotators(const FVector& Forward, const FVector& Axis, float Spread, int32 NumRotators);
 	
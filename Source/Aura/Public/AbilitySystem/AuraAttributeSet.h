@@ -7,6 +7,8 @@
 #include "AttributeSet.h"
 #include "AuraAttributeSet.generated.h"
 
+enum class EAuraSiphonType : uint8;
+
 #define ATTRIBUTE_ACCESSORS(ClassName, PropertyName) \
 	GAMEPLAYATTRIBUTE_PROPERTY_GETTER(ClassName, PropertyName) \
 	GAMEPLAYATTRIBUTE_VALUE_GETTER(PropertyName) \
@@ -62,6 +64,12 @@ public:
 	virtual void PostGameplayEffectExecute(const struct FGameplayEffectModCallbackData &Data) override;
 	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
 
+	/**
+	 * Grants several XP rewards to this set's avatar at once, resolving level ups and point rewards a single time.
+	 * IncomingXP from every kill in a frame (e.g. an AoE hit) is queued and awarded through here on the next tick.
+	 */
+	void AwardXP(TArrayView<const int32> XPRewards);
+
 	TMap<FGameplayTag, TBaseStaticDelegateInstance<FGameplayAttribute(), FDefaultDelegateUserPolicy>::FFuncPtr> TagsToAttributes;
 
 	/*
@@ -122,7 +130,7 @@ public:
 	FGameplayAttributeData MaxHealth;
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, MaxHealth)
 
-	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_MaxHealth, Category = "Secondary Attributes")
+	UPROPERTY(BlueprintReadOnly, ReplicatedUsing=OnRep_MaxMana, Category = "Secondary Attributes")
 	FGameplayAttributeData MaxMana;
 	ATTRIBUTE_ACCESSORS(UAuraAttributeSet, MaxMana)
 	
@@ -240,13 +248,21 @@ public:
 	void OnRep_PhysicalResistance(const FGameplayAttributeData& OldPhysicalResistance) const;
 
 private:
+	/**
+	 * Vitals (Health, Mana, MaxHealth, MaxMana) always replicate to everyone. Primary, secondary and resistance
+	 * attributes only go to the owner unless Aura.Net.AttributeReplicationTiers is 0. Set once per instance at construction.
+	 */
+	void SetDetailAttributesReplicateToAll(bool bReplicateToAll);
+	void MarkAttributeDirty(const FGameplayAttribute& Attribute);
 	void HandleIncomingDamage(const FEffectProperties& EffectProperties);
 	void HandleIncomingXP(const FEffectProperties& EffectProperties);
 	void Debuff(const FEffectProperties& EffectProperties);
-	static void Siphon(const FString& Attribute, float Damage, const FEffectProperties& Props);
+	static void Siphon(EAuraSiphonType SiphonType, float Damage, const FEffectProperties& Props);
 	void SetEffectProperties(const FGameplayEffectModCallbackData& Data, FEffectProperties& EffectProperties) const;
 	void ShowFloatingText(const FEffectProperties& EffectProperties, float DamageAmount, bool bBlockedHit, bool bCriticalHit) const;
 	void SendXPEvent(const FEffectProperties& EffectProperties);
+	void FlushPendingXP();
+	TArray<int32> PendingXPRewards;
 	bool bTopOffHealth = false;
 	bool bTopOffMana = false;
-};
\ No newline at end of file
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "AbilitySystem/Data/AuraTagIndex.h"
 #include "Engine/DataAsset.h"
 #include "AbilityInfo.generated.h"
 
@@ -64,7 +65,19 @@ class AURA_API UAbilityInfo : public UDataAsset
 public:
 	UFUNCTION(BlueprintCallable)
 	FAuraAbilityInfo FindAbilityInfoForTag(const FGameplayTag& AbilityTag, bool bLogNotFound = false) const;
+
+	/** Indexed lookup without the copy. Returns an empty info if the tag isn't found. */
+	const FAuraAbilityInfo& GetAbilityInfoForTag(const FGameplayTag& AbilityTag, bool bLogNotFound = false) const;
 	
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Ability Information")
 	TArray<FAuraAbilityInfo> AbilityInformation;
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+
+	TAuraTagIndex<FAuraAbilityInfo> AbilityIndex;
 };
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "AttributeSet.h"
 #include "GameplayTagContainer.h"
+#include "AbilitySystem/Data/AuraTagIndex.h"
 #include "Engine/DataAsset.h"
 #include "AttributeInfo.generated.h"
 
@@ -42,7 +43,19 @@ class AURA_API UAttributeInfo : public UDataAsset
 public:
 	UFUNCTION(BlueprintCallable)
 	FAuraAttributeInfo FindAttributeInfoForTag(const FGameplayTag& AttributeTag, bool bLogNotFound = false) const;
+
+	/** Indexed lookup without the copy. Returns nullptr if the tag isn't found. */
+	const FAuraAttributeInfo* GetAttributeInfoForTag(const FGameplayTag& AttributeTag, bool bLogNotFound = false) const;
 	
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Attribute Information")
 	TArray<FAuraAttributeInfo> AttributeInformation;
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+
+	TAuraTagIndex<FAuraAttributeInfo> AttributeIndex;
 };
@@ -0,0 +1,42 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Templates/Invoke.h"
+
+/**
+ * Tag -> row lookup for data assets that hold an array of tagged rows. The owning asset rebuilds it
+ * in PostLoad and PostEditChangeProperty; lookups hand back the row in place instead of a copy.
+ * When several rows share a tag the first one wins, same as a front to back search.
+ */
+template<typename RowType>
+struct TAuraTagIndex
+{
+	/** Projection maps a row to the tag it is filed under, an invalid tag leaves the row out */
+	template<typename ProjectionType>
+	void Build(const TArray<RowType>& Rows, ProjectionType Projection)
+	{
+		RowIndices.Reset();
+		RowIndices.Reserve(Rows.Num());
+		for(int32 RowIndex = 0; RowIndex < Rows.Num(); RowIndex++)
+		{
+			const FGameplayTag Tag = Invoke(Projection, Rows[RowIndex]);
+			if(Tag.IsValid() && !RowIndices.Contains(Tag))
+			{
+				RowIndices.Add(Tag, RowIndex);
+			}
+		}
+	}
+
+	const RowType* Find(const TArray<RowType>& Rows, const FGameplayTag& Tag) const
+	{
+		const int32* RowIndex = RowIndices.Find(Tag);
+		return RowIndex && Rows.IsValidIndex(*RowIndex) ? &Rows[*RowIndex] : nullptr;
+	}
+
+private:
+
+	TMap<FGameplayTag, int32> RowIndices;
+};
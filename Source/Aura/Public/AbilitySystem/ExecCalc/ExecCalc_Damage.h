@@ -19,7 +19,7 @@ public:
 	UExecCalc_Damage();
 	void DetermineDebuff(const FGameplayEffectCustomExecutionParameters& ExecutionParams,
 	                     const FGameplayEffectSpec& Spec,
-	                     FAggregatorEvaluateParameters EvaluationParameters, TMap<FGameplayTag, FGameplayEffectAttributeCaptureDefinition>& InTagsToDefs) const;
+	                     FAggregatorEvaluateParameters EvaluationParameters, TArrayView<const int32> DebuffRolls) const;
 
 	static float ApplyDamageReductionByHaloOfProtection(float Damage,
 												 const UAbilitySystemComponent* TargetASC,
@@ -10,6 +10,39 @@
 class UNiagaraSystem;
 class USphereComponent;
 class UProjectileMovementComponent;
+class UAuraProjectilePool;
+class UAuraProjectileManager;
+
+/** Everything a client needs to fly a projectile on its own, sent once per launch */
+USTRUCT()
+struct FAuraProjectileLaunch
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FVector_NetQuantize10 Location = FVector::ZeroVector;
+
+	UPROPERTY()
+	FVector_NetQuantize10 Velocity = FVector::ZeroVector;
+
+	/** Homes on this actor's root when set, otherwise on HomingLocation if HomingAcceleration is non zero */
+	UPROPERTY()
+	TObjectPtr<AActor> HomingActor = nullptr;
+
+	UPROPERTY()
+	FVector_NetQuantize HomingLocation = FVector::ZeroVector;
+
+	UPROPERTY()
+	float HomingAcceleration = 0.f;
+
+	/** Server world time of the launch, clients fast-forward by how late they received it */
+	UPROPERTY()
+	double ServerTime = 0.0;
+
+	/** Bumped on every launch so a reused projectile fired with identical parameters still notifies */
+	UPROPERTY()
+	uint8 LaunchCount = 0;
+};
 
 UCLASS()
 class AURA_API AAuraProjectile : public AActor
@@ -19,6 +52,7 @@ class AURA_API AAuraProjectile : public AActor
 public:
 	AAuraProjectile();
 	
+	/** Never ticks. Holds the speed, gravity and homing settings UAuraProjectileManager flies the projectile with. */
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<UProjectileMovementComponent> ProjectileMovement;
 
@@ -28,26 +62,99 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category="Damage")
 	FGameplayTag DamageType = FGameplayTag();
 
-	UPROPERTY()
+	/** Fixed homing target for bolts fired at a location, kept for the projectile's whole life */
+	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<USceneComponent> HomingTargetSceneComponent;
 
+	/** How many of this class UAuraProjectilePool::Prewarm keeps ready */
+	UPROPERTY(EditDefaultsOnly, Category="Pool")
+	int32 PoolPrewarmCount = 8;
+
+	/** Server. Puts a projectile taken from the pool back in flight from its current transform. */
+	void ActivateFromPool();
+
+	/** Server. Hides and parks the projectile, it keeps replicating as inactive until it is reused. */
+	void DeactivateIntoPool();
+
+	/** Server. Hands the projectile back to its pool, destroys it if there's no room. */
+	void ReturnToPool();
+
+	bool IsPoolActive() const { return bPoolActive; }
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	void ApplyImpactEffects();
 	virtual void Destroyed() override;
 
-	UFUNCTION()
-	void OnSphereOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-	
+	/** Called on every machine when the projectile leaves or enters the pool */
+	UFUNCTION(BlueprintImplementableEvent)
+	void OnPoolActiveChanged(bool bActive);
+
+	/** Server. Called by UAuraProjectileManager for each actor the projectile swept through, true if it hit and stopped. */
+	bool HandleImpact(AActor* OtherActor, const FVector& ImpactLocation);
+
+	/** Called by UAuraProjectileManager when the projectile's life runs out */
+	void HandleLifetimeExpired();
+
+	/** Radius and channel responses of the manager's sweeps. The sphere itself has no collision. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TObjectPtr<USphereComponent> Sphere;
 
 private:
 
+	friend UAuraProjectilePool;
+	friend UAuraProjectileManager;
+
+	/** Server. Fills LaunchState from the current transform and movement settings, then starts simulating. */
+	void Launch();
+
+	/** Hands LaunchState to the projectile manager, CatchUpTime seconds into the flight */
+	void StartSimulation(float CatchUpTime);
+	void StopSimulation();
+
+	/** A new LaunchCount while the previous flight is still live here means the server parked and reused the projectile within one net update */
+	UFUNCTION()
+	void OnRep_LaunchState(const FAuraProjectileLaunch& OldLaunchState);
+
+	/** Client. Plays the impact of a flight the server parked at ImpactLocation. */
+	void PlayParkedImpact();
+
+	/** Applies the local side of entering or leaving the pool: visibility, collision, movement and looping sound */
+	void SetPoolActive(bool bActive);
+
+	UFUNCTION()
+	void OnRep_PoolActive();
+
 	UPROPERTY(EditDefaultsOnly)
 	float LifeSpan = 15.f;
 	
 	bool bHit = false;
+
+	UPROPERTY(ReplicatedUsing=OnRep_PoolActive)
+	bool bPoolActive = true;
+
+	UPROPERTY(ReplicatedUsing=OnRep_LaunchState)
+	FAuraProjectileLaunch LaunchState;
+
+	/** LaunchCount of the flight that was live when the projectile was last seen parked */
+	uint8 ParkedLaunchCount = 0;
+
+	/** Where the server stopped the projectile, clients play the impact there */
+	UPROPERTY(Replicated)
+	FVector_NetQuantize10 ImpactLocation = FVector::ZeroVector;
+
+	/** Slot in UAuraProjectileManager's arrays while simulating */
+	int32 SimIndex = INDEX_NONE;
+
+	/** Set by the pool before FinishSpawning for projectiles that should start parked */
+	bool bSpawnIntoPool = false;
+
+	/** Net update rate while in flight, restored when leaving the pool */
+	float ActiveNetUpdateFrequency = 0.f;
+
+	TWeakObjectPtr<UAuraProjectilePool> OwningPool;
 	
 	UPROPERTY(EditAnywhere)
 	TObjectPtr<UNiagaraSystem> ImpactEffect;
@@ -82,20 +82,20 @@ public:
 	bool IsCriticalHit() const { return bIsCriticalHit; }
 	bool IsBlockedHit() const { return bIsBlockedHit; }
 	bool IsSuccessfulDebuff() const { return bIsSuccessfulDebuff; }
-	FScalableFloat GetDebuffDamage() const { return DebuffDamage; }
-	FScalableFloat GetDebuffDuration() const { return DebuffDuration; }
-	FScalableFloat GetDebuffFrequency() const { return DebuffFrequency; }
-	TSharedPtr<FGameplayTag> GetDamageType() const { return DamageType; }
+	float GetDebuffDamage() const { return DebuffDamage; }
+	float GetDebuffDuration() const { return DebuffDuration; }
+	float GetDebuffFrequency() const { return DebuffFrequency; }
+	const FGameplayTag& GetDamageType() const { return DamageType; }
 	FVector GetDeathImpulse() const { return DeathImpulse; }
 	FVector GetKnockBackForce() const { return KnockBackForce; }
 
 	void SetIsCriticalHit(bool bInIsCriticalHit) { bIsCriticalHit = bInIsCriticalHit; }
 	void SetIsBlockedHit(bool bInIsBlockedHit) { bIsBlockedHit = bInIsBlockedHit; }
 	void SetIsSuccessfulDebuff(bool bInIsSuccessFulDebuff) { bIsSuccessfulDebuff = bInIsSuccessFulDebuff; }
-	void SetDebuffDamage(FScalableFloat InDebuffDamage) { DebuffDamage = InDebuffDamage; }
-	void SetDebuffDuration(FScalableFloat InDebuffDuration) { DebuffDuration = InDebuffDuration; }
-	void SetDebuffFrequency(FScalableFloat InDebuffFrequency) { DebuffFrequency = InDebuffFrequency; }
-	void SetDamageType(TSharedPtr<FGameplayTag> InDamageType) { DamageType = InDamageType; }
+	void SetDebuffDamage(float InDebuffDamage) { DebuffDamage = InDebuffDamage; }
+	void SetDebuffDuration(float InDebuffDuration) { DebuffDuration = InDebuffDuration; }
+	void SetDebuffFrequency(float InDebuffFrequency) { DebuffFrequency = InDebuffFrequency; }
+	void SetDamageType(const FGameplayTag& InDamageType) { DamageType = InDamageType; }
 	void SetDeathImpulse(FVector InDeathImpulse) { DeathImpulse = InDeathImpulse; }
 	void SetKnockBackForce(FVector InKnockBackForce) { KnockBackForce = InKnockBackForce; }
 	
@@ -121,6 +121,20 @@ public:
 	/** Custom serialization, subclasses must override this */
 	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
 
+	/**
+	 * Contexts are created and released for every hit. Heap allocations (new, Duplicate, UAuraAbilitySystemGlobals::AllocGameplayEffectContext)
+	 * go through a per-thread free list, so once it's warm a hit doesn't touch the allocator.
+	 */
+	static void* operator new(size_t Size);
+	static void operator delete(void* Ptr, size_t Size);
+
+	// Declaring the pooled forms hides the global placement forms, struct ops and containers still need them
+	static void* operator new(size_t Size, void* Place) { return Place; }
+	static void operator delete(void* Ptr, void* Place) {}
+
+	/** Blocks that had to come from the allocator because the calling thread's free list was empty */
+	static uint64 GetNumPoolMisses();
+
 protected:
 
 	UPROPERTY()
@@ -132,16 +146,18 @@ protected:
 	UPROPERTY()
 	bool bIsSuccessfulDebuff = false;
 
+	// The debuff values replicate in steps of 0.1 from 0 to 1000000, a value between 0 and 0.1 arrives as 0.1
 	UPROPERTY()
-	FScalableFloat DebuffDamage = 0.f;
+	float DebuffDamage = 0.f;
 
 	UPROPERTY()
-	FScalableFloat DebuffDuration = 0.f;
+	float DebuffDuration = 0.f;
 
 	UPROPERTY()
-	FScalableFloat DebuffFrequency = 0.f;
+	float DebuffFrequency = 0.f;
 	
-	TSharedPtr<FGameplayTag> DamageType;
+	UPROPERTY()
+	FGameplayTag DamageType;
 
 	UPROPERTY()
 	FVector DeathImpulse = FVector::ZeroVector;
@@ -5,6 +5,23 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 
+/** Dense index of the damage types, in the order of FAuraGameplayTags::DamageTypes */
+enum class EAuraDamageType : uint8
+{
+	Fire,
+	Lightning,
+	Arcane,
+	Physical,
+	MAX
+};
+
+struct FAuraDamageTypeTags
+{
+	FGameplayTag DamageType;
+	FGameplayTag Resistance;
+	FGameplayTag Debuff;
+};
+
 /**
  * AuraGameplayTags
  *
@@ -38,6 +55,7 @@ public:
 	FGameplayTag Attributes_Meta_IncomingXP;
 
 	// input tags
+	FGameplayTag InputTag;
 	FGameplayTag InputTag_LMB;
 	FGameplayTag InputTag_RMB;
 	FGameplayTag InputTag_1;
@@ -75,12 +93,14 @@ public:
 	FGameplayTag Debuff_Duration;
 
 	// abilities 
+	FGameplayTag Abilities;
 	FGameplayTag Abilities_None;
 	FGameplayTag Abilities_Attack;
 	FGameplayTag Abilities_Summon;
 	
 	FGameplayTag Abilities_HitReact;
 
+	FGameplayTag Abilities_Status;
 	FGameplayTag Abilities_Status_Locked;
 	FGameplayTag Abilities_Status_Eligible;
 	FGameplayTag Abilities_Status_Unlocked;
@@ -97,6 +117,7 @@ public:
 	FGameplayTag Abilities_Lightning_Electrocute;
 
 	// Passive abilities
+	FGameplayTag Abilities_Passive;
 	FGameplayTag Abilities_Passive_HaloOfProtection;
 	FGameplayTag Abilities_Passive_LifeSiphon;
 	FGameplayTag Abilities_Passive_ManaSiphon;
@@ -119,6 +140,19 @@ public:
 	TMap<FGameplayTag, FGameplayTag> DamageTypesToResistances;
 	TMap<FGameplayTag, FGameplayTag> DamageTypesToDebuffs;
 
+	// damage type, resistance and debuff tags indexed by EAuraDamageType
+	FAuraDamageTypeTags DamageTypes[static_cast<uint8>(EAuraDamageType::MAX)];
+
+	/** Returns the EAuraDamageType index of DamageTypeTag, or INDEX_NONE if it isn't a damage type */
+	int32 GetDamageTypeIndex(const FGameplayTag& DamageTypeTag) const
+	{
+		for(int32 i = 0; i < UE_ARRAY_COUNT(DamageTypes); i++)
+		{
+			if(DamageTypes[i].DamageType == DamageTypeTag) return i;
+		}
+		return INDEX_NONE;
+	}
+
 	// effects
 	FGameplayTag Effects_HitReact;
 
@@ -25,6 +25,7 @@ public:
 	virtual void OnRep_PlayerState() override;
 
 	/** UPlayerInterface */
+	virtual const ULevelUpInfo* GetLevelUpInfo() const override;
 	virtual int32 GetXP_Implementation() const override;
 	virtual void AddToXP_Implementation(int32 XPToAdd) override;
 	virtual void LevelUp_Implementation() override;
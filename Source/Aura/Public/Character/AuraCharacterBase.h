@@ -50,8 +50,12 @@ public:
 	virtual USkeletalMeshComponent* GetWeapon_Implementation() override;
 	virtual void SetIsBeingShocked_Implementation(bool bInShock) override;
 	virtual bool IsBeingShocked_Implementation() const override;
+	virtual int32 GetFactionMask() const override { return FactionMask; }
 	/** end ICombatInterface */
 
+	/** Server only, replicates to clients and updates the combatant registry */
+	void SetFactionMask(int32 InFactionMask);
+
 	FOnASCRegistered OnAscRegistered;
 	FOnDeath OnDeath;
 	FOnDeathSignature OnDeathDelegateSign; 
@@ -77,8 +81,12 @@ public:
 	UFUNCTION()
 	virtual void OnRep_Burned();
 
+	UFUNCTION()
+	void OnRep_FactionMask();
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Combat")
 	TObjectPtr<USkeletalMeshComponent> Weapon;
@@ -148,6 +156,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Character Class Defaults")
 	ECharacterClass CharacterClass = ECharacterClass::Warrior;
 
+	/** Factions this character belongs to, see EAuraFaction. Characters sharing a faction don't hurt each other. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, ReplicatedUsing=OnRep_FactionMask, Category="Combat", meta=(Bitmask, BitmaskEnum="/Script/Aura.EAuraFaction"))
+	int32 FactionMask = 0;
+
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<UDebuffNiagaraComponent> BurnDebuffComponent;
 
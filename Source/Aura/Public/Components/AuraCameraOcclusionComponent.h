@@ -0,0 +1,67 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "AuraCameraOcclusionComponent.generated.h"
+
+/**
+ * Fades whatever stands between the local player's camera and their pawn or the nearest hostiles.
+ * Every QueryInterval it issues one async sphere sweep per target on the FadeActor channel. When the whole batch is
+ * back the hit set is diffed against the previous one, and only objects that started or stopped occluding get
+ * IFadeInterface::FadeOut or FadeIn. Never traces synchronously.
+ * Off unless Aura.Camera.Occlusion is set, the overlap box on BP_AuraCharacter_Topdown drives the same objects.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class AURA_API UAuraCameraOcclusionComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAuraCameraOcclusionComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Seconds between query batches */
+	UPROPERTY(EditDefaultsOnly, Category="Occlusion")
+	float QueryInterval = 0.1f;
+
+	UPROPERTY(EditDefaultsOnly, Category="Occlusion")
+	float SweepRadius = 20.f;
+
+	/** How many of the nearest hostiles are kept visible besides the pawn */
+	UPROPERTY(EditDefaultsOnly, Category="Occlusion")
+	int32 MaxHostiles = 4;
+
+	UPROPERTY(EditDefaultsOnly, Category="Occlusion")
+	float HostileRadius = 1500.f;
+
+private:
+
+	void IssueQueries();
+	void OnSweepComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void ResolveQueries();
+
+	/** Fades everything this component faded back in and drops the batch in flight */
+	void RestoreOccluders();
+
+	/** The actor itself if it implements IFadeInterface, otherwise its first component that does */
+	static UObject* FindFadeTarget(AActor* Actor);
+
+	FTraceDelegate SweepDelegate;
+
+	/** Tags each batch's sweeps so results from a dropped batch are ignored */
+	uint32 BatchId = 0;
+	int32 NumPendingSweeps = 0;
+	double BatchIssueTime = 0.0;
+
+	TArray<AActor*> Targets;
+	TSet<TWeakObjectPtr<UObject>> PendingOccluders;
+	TSet<TWeakObjectPtr<UObject>> Occluders;
+};
@@ -0,0 +1,69 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WorldCollision.h"
+#include "AuraCursorHitComponent.generated.h"
+
+/**
+ * What's under the local player's cursor on the Visibility and Target channels, shared by highlighting,
+ * click-to-move and ability targeting. A channel is only traced again when the cursor ray changes, the hit actor or
+ * the combatants around the hit move, or the result is older than Aura.Cursor.MaxTraceAge. Those traces are async
+ * and land a frame later. Callers that can't take that latency ask for a current hit and get a synchronous trace
+ * only if the cached one is out of date.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class AURA_API UAuraCursorHitComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAuraCursorHitComponent();
+
+	/** Issues async traces for the channels whose cached hit went stale. Call once per frame. */
+	void UpdateTraces();
+
+	/** Cached hit for ECC_Visibility or ECC_Target. bRequireCurrent traces now if the cache doesn't match the cursor. */
+	const FHitResult& GetHitResult(ECollisionChannel Channel, bool bRequireCurrent = false);
+
+protected:
+	virtual void BeginPlay() override;
+
+	/** Combatants moving within this distance of a cached hit invalidate it */
+	UPROPERTY(EditDefaultsOnly, Category="Cursor")
+	float NearbyRadius = 300.f;
+
+private:
+
+	struct FChannelHit
+	{
+		ECollisionChannel Channel = ECC_Visibility;
+		FHitResult Hit;
+
+		/** Cursor ray, hit actor location and nearby combatant signature the hit was traced with */
+		FVector RayOrigin = FVector::ZeroVector;
+		FVector RayDirection = FVector::ZeroVector;
+		FVector HitActorLocation = FVector::ZeroVector;
+		FVector NearbySignature = FVector::ZeroVector;
+		double TraceTime = -1.0;
+
+		bool bPending = false;
+		uint32 PendingId = 0;
+		FVector PendingOrigin = FVector::ZeroVector;
+		FVector PendingDirection = FVector::ZeroVector;
+	};
+
+	FChannelHit* FindChannel(ECollisionChannel Channel);
+	bool GetCursorRay(FVector& OutOrigin, FVector& OutDirection) const;
+	bool IsStale(const FChannelHit& ChannelHit, const FVector& RayOrigin, const FVector& RayDirection) const;
+	FVector GetNearbySignature(const FVector& Location) const;
+	void StoreHit(FChannelHit& ChannelHit, const FHitResult& Hit, const FVector& RayOrigin, const FVector& RayDirection);
+	void OnTraceComplete(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+
+	FChannelHit ChannelHits[2];
+
+	FTraceDelegate TraceDelegate;
+	uint32 NextTraceId = 0;
+};
@@ -0,0 +1,65 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "NavigationData.h"
+#include "AuraPathRequestComponent.generated.h"
+
+DECLARE_DELEGATE_OneParam(FAuraPathReadyDelegate, const TArray<FVector>& /*PathPoints*/);
+
+/**
+ * Click-to-move pathfinding for the owning player controller's pawn. Paths are found on the navigation system's
+ * async queue instead of the game thread, and only the latest request is kept: a newer click aborts the one in
+ * flight. Finished paths are cached by (start cell, goal cell) for Aura.ClickMove.PathCacheLifetime seconds, so
+ * clicking again around the same spot is answered straight away. A cached path is handed out starting at the pawn
+ * and ending at the new goal projected onto the navmesh.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class AURA_API UAuraPathRequestComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UAuraPathRequestComponent();
+
+	/**
+	 * Finds a path from the controlled pawn to Goal and hands its points to OnReady, right away on a cache hit or
+	 * when the async query finishes. Supersedes any request in flight. Returns false if there's nothing to path for.
+	 */
+	bool RequestPath(const FVector& Goal, const FAuraPathReadyDelegate& OnReady);
+
+	/** Drops the request in flight, its result is never delivered */
+	void CancelRequest();
+
+	bool IsRequestPending() const { return PendingQueryId != INVALID_NAVQUERYID; }
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+
+	struct FCachedPath
+	{
+		FIntVector StartCell = FIntVector::ZeroValue;
+		FIntVector GoalCell = FIntVector::ZeroValue;
+		TArray<FVector> Points;
+		double FoundTime = 0.0;
+		double LastUsedTime = 0.0;
+	};
+
+	static FIntVector CellOf(const FVector& Location);
+
+	FCachedPath* FindCachedPath(const FIntVector& StartCell, const FIntVector& GoalCell);
+	void CachePath(const FIntVector& StartCell, const FIntVector& GoalCell, const TArray<FVector>& Points);
+	void OnPathFound(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+
+	TArray<FCachedPath> CachedPaths;
+
+	uint32 PendingQueryId = INVALID_NAVQUERYID;
+	FIntVector PendingStartCell = FIntVector::ZeroValue;
+	FIntVector PendingGoalCell = FIntVector::ZeroValue;
+	double PendingRequestTime = 0.0;
+	FAuraPathReadyDelegate PendingOnReady;
+};
@@ -10,6 +10,12 @@
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FSetFadeOut);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FSetFadeIn);
 
+class UCurveFloat;
+
+/**
+ * Fades an occluding mesh out and back in. The fade is stepped by UAuraFadeManager, which writes it to the "Fade"
+ * scalar parameter of dynamic instances of FadeMaterialInstances (MI_FadeMaterial).
+ */
 UCLASS(Blueprintable, BlueprintType, meta=(BlueprintSpawnableComponent))
 class AURA_API UFadeObjectComponent : public UActorComponent, public IFadeInterface
 {
@@ -30,11 +36,18 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SetupMaterials();
 
+	/** Writes AnimationProgress through FadeCurve to the Fade parameter of DynamicMaterialInstances */
+	void ApplyFadeValue();
+
+	/** Seconds for a full fade out or in */
+	float GetFadeDuration() const { return FadeTime * 100.f; }
+
 	/*UFadeInterface*/
 	virtual void FadeOut_Implementation() override;
 	virtual void FadeIn_Implementation() override;
 	/*end UFadeInterface*/
 
+	/** 1 fully visible, 0 fully faded */
 	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category="Default")
 	float AnimationProgress = 1.0f;
 
@@ -50,24 +63,33 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Fade Properties")
 	bool bBlockVisibility = false;
 
-	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category="Default")
+	/** Unused, fades are stepped by UAuraFadeManager. Kept so Blueprints that reference it still compile */
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category="Default", meta=(DeprecatedProperty, DeprecationMessage="Fades are stepped by UAuraFadeManager"))
 	FTimerHandle FadeOutTimer;
 
 	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category="Default")
 	TObjectPtr<UStaticMeshComponent> Mesh;
 
-	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category="Default")
+	/** Unused, fades are stepped by UAuraFadeManager. Kept so Blueprints that reference it still compile */
+	UPROPERTY(BlueprintReadWrite, EditDefaultsOnly, Category="Default", meta=(DeprecatedProperty, DeprecationMessage="Fades are stepped by UAuraFadeManager"))
 	FTimerHandle FadeInTimer;
 
-	UFUNCTION(BlueprintCallable)
+	/** Starts fading out, use FadeOut */
+	UFUNCTION(BlueprintCallable, meta=(DeprecatedFunction, DeprecationMessage="Use FadeOut"))
 	void SetFadeOut();
 
-	UFUNCTION(BlueprintCallable)
+	/** Starts fading in, use FadeIn */
+	UFUNCTION(BlueprintCallable, meta=(DeprecatedFunction, DeprecationMessage="Use FadeIn"))
 	void SetFadeIn();
 
+	/** Seconds per 1% of the fade, a full fade out or in takes 100 * FadeTime */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Fade Properties")
 	float FadeTime = 0.004f;
 
+	/** Maps AnimationProgress to the Fade value, linear when unset */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="Fade Properties")
+	TObjectPtr<UCurveFloat> FadeCurve;
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -0,0 +1,35 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraClassInfoSubsystem.generated.h"
+
+class UCharacterClassInfo;
+
+/**
+ * The game mode's character class info, resolved once when the world's game starts.
+ * Damage executions and siphon procs read it from here instead of going through the game mode on every hit.
+ */
+UCLASS()
+class AURA_API UAuraClassInfoSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Class info of WorldContextObject's world, nullptr outside a game world or before the game mode set it */
+	static UCharacterClassInfo* GetCharacterClassInfo(const UObject* WorldContextObject);
+
+	void SetCharacterClassInfo(UCharacterClassInfo* InCharacterClassInfo) { CharacterClassInfo = InCharacterClassInfo; }
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	UPROPERTY()
+	TObjectPtr<UCharacterClassInfo> CharacterClassInfo;
+};
@@ -0,0 +1,98 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraCombatRandomSubsystem.generated.h"
+
+class UAuraCombatantRegistry;
+
+/**
+ * Rolls for a single combat event. The Nth roll is a pure function of the stream key and N (SplitMix64),
+ * so draws don't depend on each other and a batch can be generated in one pass.
+ */
+struct FAuraCombatRollStream
+{
+	uint64 Key = 0;
+	uint32 Counter = 0;
+
+	static uint64 Mix(uint64 Value)
+	{
+		Value += 0x9E3779B97F4A7C15ull;
+		Value = (Value ^ (Value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		Value = (Value ^ (Value >> 27)) * 0x94D049BB133111EBull;
+		return Value ^ (Value >> 31);
+	}
+
+	static int32 BitsToPercent(uint64 Bits)
+	{
+		return 1 + static_cast<int32>(((Bits >> 32) * 100ull) >> 32);
+	}
+
+	uint64 NextBits() { return Mix(Key + 0x9E3779B97F4A7C15ull * Counter++); }
+
+	/** Integer in [1, 100], same range as FMath::RandRange(1, 100) */
+	int32 RollPercent() { return BitsToPercent(NextBits()); }
+
+	/** Fills OutRolls with the next OutRolls.Num() percent rolls */
+	void RollPercentBatch(TArrayView<int32> OutRolls)
+	{
+		const uint64 BaseCounter = Counter;
+		for(int32 i = 0; i < OutRolls.Num(); i++)
+		{
+			OutRolls[i] = BitsToPercent(Mix(Key + 0x9E3779B97F4A7C15ull * (BaseCounter + i)));
+		}
+		Counter += OutRolls.Num();
+	}
+};
+
+/**
+ * Seeded random source for combat rolls (block, critical hit, debuff, knockback).
+ * Each (source, target) pair gets its own event counter, so with the same seed and the same hits
+ * a run reproduces the same outcomes regardless of what other actors are doing. A pair's counter is dropped
+ * once either actor leaves play.
+ */
+UCLASS()
+class AURA_API UAuraCombatRandomSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Opens a roll stream for an event from Source on Target. Falls back to an unseeded stream outside a game world. */
+	static FAuraCombatRollStream MakeRollStream(const UObject* WorldContextObject, const AActor* Source, const AActor* Target, int32 PredictionKey = 0);
+
+	FAuraCombatRollStream BeginRolls(const AActor* Source, const AActor* Target, int32 PredictionKey);
+
+	/** Drops the event counters of every pair Actor is part of. Call before the actor leaves the combatant registry. */
+	void ForgetActor(const AActor* Actor);
+
+	/** Hash of the actor's name rather than its address or unique id, names are stable between runs with the same spawn order */
+	static uint32 StableActorHash(const AActor* Actor);
+
+	void SetSeed(uint64 InSeed);
+	uint64 GetSeed() const { return Seed; }
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	uint32 GetStableHash(const AActor* Actor) const;
+
+	uint64 Seed = 0;
+
+	/** Keyed by (source hash << 32 | target hash) */
+	TMap<uint64, uint32> PairEventCounters;
+
+	/** Pair keys each actor hash appears in, so a leaving actor's counters can be dropped without a full scan */
+	TMap<uint32, TArray<uint64>> PairKeysByActor;
+
+	/** Caches every combatant's stable hash */
+	UPROPERTY()
+	TObjectPtr<UAuraCombatantRegistry> CombatantRegistry;
+};
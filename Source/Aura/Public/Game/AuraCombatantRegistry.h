@@ -0,0 +1,99 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraCombatantRegistry.generated.h"
+
+/**
+ * Every live character in the world, bucketed in a uniform XY grid.
+ * Target queries (radius, k-nearest, nearest hostile) walk the cells around the origin instead of running
+ * physics overlaps or iterating the actor list. Locations are refreshed once a frame and an entry only moves
+ * between cells when it crosses a cell boundary.
+ */
+UCLASS()
+class AURA_API UAuraCombatantRegistry : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UAuraCombatantRegistry* Get(const UObject* WorldContextObject);
+
+	/** Faction mask comes from ICombatInterface::GetFactionMask */
+	void Register(AActor* Combatant);
+	void Unregister(const AActor* Combatant);
+	void SetAlive(const AActor* Combatant, bool bAlive);
+	void SetFactionMask(const AActor* Combatant, int32 FactionMask);
+
+	/** Re-reads every combatant's location and moves the ones that changed cell. Runs every tick. */
+	void RefreshLocations();
+
+	/** Appends the alive combatants whose capsule reaches into the sphere */
+	void GetAliveInRadius(const FVector& Origin, float Radius, TArray<AActor*>& OutActors, TConstArrayView<AActor*> ActorsToIgnore = {}) const;
+
+	/**
+	 * Appends up to K alive combatants, nearest first. Radius <= 0 searches the whole grid.
+	 * Only combatants sharing a bit with IncludeFactions (0 accepts any) and none with ExcludeFactions are considered.
+	 */
+	void GetKNearest(const FVector& Origin, int32 K, float Radius, TArray<AActor*>& OutActors, TConstArrayView<AActor*> ActorsToIgnore = {}, int32 IncludeFactions = 0, int32 ExcludeFactions = 0) const;
+
+	/** Closest alive combatant that shares no faction with Querier, or nullptr */
+	AActor* FindNearestHostile(const AActor* Querier, float& OutDistance) const;
+
+	int32 Num() const { return Combatants.Num(); }
+
+	/** UAuraCombatRandomSubsystem::StableActorHash of the combatant, cached at registration. Computed for actors that aren't registered. */
+	uint32 GetStableHash(const AActor* Actor) const;
+
+	/** UTickableWorldSubsystem */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/** end UTickableWorldSubsystem */
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	struct FCombatant
+	{
+		AActor* Actor = nullptr;
+		FVector Location = FVector::ZeroVector;
+		float Radius = 0.f;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+		int32 FactionMask = 0;
+		uint32 StableHash = 0;
+		bool bAlive = true;
+	};
+
+	FIntPoint CellOf(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt32(Location.X * InvCellSize), FMath::FloorToInt32(Location.Y * InvCellSize));
+	}
+
+	void AddToCell(int32 CombatantIndex);
+	void RemoveFromCell(int32 CombatantIndex);
+
+	/** Calls Visit(CombatantIndex) for every entry in the cells overlapping the XY square around Origin */
+	template<typename VisitorType>
+	void ForEachInBox(const FVector& Origin, float HalfExtent, VisitorType&& Visit) const;
+
+	float CellSize = 1000.f;
+	float InvCellSize = 1.f / 1000.f;
+
+	/** Largest capsule radius registered, queries widen by it so edge cells aren't missed */
+	float MaxCombatantRadius = 0.f;
+
+	TArray<FCombatant> Combatants;
+	TMap<const AActor*, int32> ActorToIndex;
+	TMap<FIntPoint, TArray<int32>> Cells;
+
+	/** Bounds of every cell used so far, an unbounded k-nearest search never walks past them */
+	FIntPoint CellBoundsMin = FIntPoint(MAX_int32, MAX_int32);
+	FIntPoint CellBoundsMax = FIntPoint(MIN_int32, MIN_int32);
+};
@@ -0,0 +1,47 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraFadeManager.generated.h"
+
+class UFadeObjectComponent;
+
+/**
+ * Steps every fading UFadeObjectComponent once a frame, replacing a looping timer per component.
+ * A component that is asked to fade the other way mid fade reverses from where it is.
+ */
+UCLASS()
+class AURA_API UAuraFadeManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UAuraFadeManager* Get(const UObject* WorldContextObject);
+
+	/** Starts fading Component out (towards 0) or in (towards 1) */
+	void Fade(UFadeObjectComponent* Component, bool bFadeOut);
+
+	int32 NumFading() const { return Fades.Num(); }
+
+	/** UTickableWorldSubsystem */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/** end UTickableWorldSubsystem */
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	struct FFade
+	{
+		TWeakObjectPtr<UFadeObjectComponent> Component;
+		bool bFadeOut = true;
+	};
+
+	TArray<FFade> Fades;
+};
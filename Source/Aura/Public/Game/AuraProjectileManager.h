@@ -0,0 +1,71 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraProjectileManager.generated.h"
+
+class AAuraProjectile;
+
+/**
+ * Flies every Aura projectile in one tick. State lives in parallel arrays (position, velocity, homing, lifetime)
+ * so integration is a tight loop, then the server sweeps each moved segment and hands hits back to the projectile.
+ * Projectiles don't replicate movement: clients rebuild the flight from the replicated launch and only the
+ * server's impact is sent back.
+ */
+UCLASS()
+class AURA_API UAuraProjectileManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UAuraProjectileManager* Get(const UObject* WorldContextObject);
+
+	/** Starts flying Projectile from Location. Speed, gravity and radius come from its components. HomingTarget may be null. */
+	void Add(AAuraProjectile* Projectile, const FVector& Location, const FVector& Velocity, const USceneComponent* HomingTarget, float HomingAcceleration, float Lifetime);
+	void Remove(AAuraProjectile* Projectile);
+
+	int32 Num() const { return Projectiles.Num(); }
+
+	/** UTickableWorldSubsystem */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/** end UTickableWorldSubsystem */
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	void Integrate(float DeltaTime);
+	void SweepAndMove();
+	void ResolveEvents();
+
+	UPROPERTY()
+	TArray<TObjectPtr<AAuraProjectile>> Projectiles;
+
+	TArray<FVector> Positions;
+	TArray<FVector> PreviousPositions;
+	TArray<FVector> Velocities;
+	TArray<TWeakObjectPtr<const USceneComponent>> HomingTargets;
+	TArray<float> HomingAccelerations;
+	TArray<float> MaxSpeeds;
+	TArray<float> GravityZs;
+	TArray<float> Radii;
+	TArray<float> RemainingLifetimes;
+	TArray<bool> RotationFollowsVelocity;
+
+	/** Collected during the sweep pass and resolved after it, resolving can remove projectiles */
+	struct FImpact
+	{
+		TWeakObjectPtr<AAuraProjectile> Projectile;
+		TWeakObjectPtr<AActor> Actor;
+		FVector Location;
+	};
+	TArray<FImpact> PendingImpacts;
+	TArray<TWeakObjectPtr<AAuraProjectile>> PendingExpiries;
+	TArray<FHitResult> SweepHits;
+};
@@ -0,0 +1,66 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraProjectilePool.generated.h"
+
+class AAuraProjectile;
+
+USTRUCT()
+struct FAuraProjectileFreeList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AAuraProjectile>> Projectiles;
+};
+
+/**
+ * Server side free lists of parked projectiles, one per class.
+ * A projectile that hits or outlives its life span is hidden and kept instead of destroyed, and the next shot of
+ * that class reuses it. Parked projectiles stay replicated, clients follow them through AAuraProjectile::bPoolActive.
+ */
+UCLASS()
+class AURA_API UAuraProjectilePool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UAuraProjectilePool* Get(const UObject* WorldContextObject);
+
+	/**
+	 * Pooled SpawnActorDeferred. Returns a parked projectile moved to Transform, or a new deferred one when the class
+	 * has none free. Set it up as usual, then launch it with FinishSpawningProjectile.
+	 */
+	static AAuraProjectile* SpawnProjectileDeferred(const UObject* WorldContextObject, TSubclassOf<AAuraProjectile> ProjectileClass,
+		const FTransform& Transform, AActor* Owner, APawn* Instigator);
+
+	/** FinishSpawning for new projectiles, reactivation for reused ones */
+	static void FinishSpawningProjectile(AAuraProjectile* Projectile, const FTransform& Transform);
+
+	/** Spawns parked projectiles until the class has Count free. Count < 0 uses the class's PoolPrewarmCount. */
+	void Prewarm(TSubclassOf<AAuraProjectile> ProjectileClass, int32 Count = -1);
+
+	/** Parks Projectile for reuse. False when pooling is off or the class's free list is full, the caller destroys it then. */
+	bool Release(AAuraProjectile* Projectile);
+
+	int32 NumFree(TSubclassOf<AAuraProjectile> ProjectileClass) const;
+
+	virtual void Deinitialize() override;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	AAuraProjectile* TakeFree(UClass* ProjectileClass);
+
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FAuraProjectileFreeList> FreeLists;
+
+	int32 NumPooled = 0;
+};
@@ -18,6 +18,19 @@ enum class ECharacterClass : uint8
 	Ranger
 };
 
+/** Curve rows of the coefficient tables that are baked into level-indexed arrays. */
+UENUM()
+enum class EAuraCoefficient : uint8
+{
+	ArmorPenetration,
+	EffectiveArmor,
+	CriticalHitResistance,
+	DamageReductionRatio,
+	LifeSiphonPercentage,
+	ManaSiphonPercentage,
+	MAX UMETA(Hidden)
+};
+
 USTRUCT(BlueprintType)
 struct FCharacterClassDefaultInfo
 {
@@ -65,4 +78,30 @@ public:
 	
 	UPROPERTY(EditDefaultsOnly, Category = "Common Class Defaults|Abilities")
 	TObjectPtr<UCurveTable> PassiveAbilityCoefficients;
+
+	/**
+	 * Value of the coefficient curve at Level, read from the baked table. Levels past the last key use the last value.
+	 * Returns Fallback when the curve row is missing, callers pick the value that leaves their formula as it was without the curve.
+	 */
+	float GetCoefficient(EAuraCoefficient Coefficient, int32 Level, float Fallback) const
+	{
+		const TArray<float>& Values = BakedCoefficients[static_cast<uint8>(Coefficient)];
+		return Values.Num() > 0 ? Values[FMath::Clamp(Level, 0, Values.Num() - 1)] : Fallback;
+	}
+
+	bool HasCoefficient(EAuraCoefficient Coefficient) const
+	{
+		return BakedCoefficients[static_cast<uint8>(Coefficient)].Num() > 0;
+	}
+
+	void BuildCoefficientCache();
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+
+	TArray<float> BakedCoefficients[static_cast<uint8>(EAuraCoefficient::MAX)];
 };
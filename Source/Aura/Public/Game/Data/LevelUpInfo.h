@@ -21,6 +21,14 @@ struct FAuraLevelUpInfo
 	int32 SpellPointAwarded = 1;
 };
 
+struct FAuraLevelUpRewards
+{
+	int32 NewLevel = 1;
+	int32 NumLevelUps = 0;
+	int32 AttributePoints = 0;
+	int32 SpellPoints = 0;
+};
+
 /**
  * 
  */
@@ -33,5 +41,29 @@ public:
 	UPROPERTY(EditDefaultsOnly)
 	TArray<FAuraLevelUpInfo> LevelUpInformation;
 
+	/** Binary search over the cumulative requirements, same result as walking the table from level 1 */
 	int32 FindLevelForXP(int32 XP) const;
+
+	/** Points awarded by LevelUpInformation[FromLevel] up to but not including LevelUpInformation[ToLevel] */
+	int32 GetAttributePointsForLevels(int32 FromLevel, int32 ToLevel) const;
+	int32 GetSpellPointsForLevels(int32 FromLevel, int32 ToLevel) const;
+
+	/** Level reached and points earned when a character at CurrentLevel ends up with TotalXP */
+	FAuraLevelUpRewards GetLevelUpRewards(int32 CurrentLevel, int32 TotalXP) const;
+
+	void BuildProgressionTables();
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+
+	/** Running max of LevelUpRequirement, so the search stays correct even if the table isn't sorted */
+	TArray<int32> CumulativeRequirements;
+
+	/** Prefix sums, [i] is the total awarded by levels [0, i) */
+	TArray<int32> AttributePointSums;
+	TArray<int32> SpellPointSums;
 };
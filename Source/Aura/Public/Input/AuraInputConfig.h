@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
+#include "AbilitySystem/Data/AuraTagIndex.h"
 #include "Engine/DataAsset.h"
 #include "AuraInputConfig.generated.h"
 
@@ -33,4 +34,15 @@ public:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly)
 	TArray<FAuraInputAction> AbilityInputActions;
+
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+
+	void BuildInputActionIndex();
+
+	TAuraTagIndex<FAuraInputAction> InputActionIndex;
 };
@@ -37,6 +37,16 @@ struct FTaggedMontage
 	bool bUseWeaponMesh = false;
 };
 
+/** Factions a combatant can belong to. Combatants are friends when their faction masks share a bit. */
+UENUM(BlueprintType, meta=(Bitflags, UseEnumValuesAsMaskValuesInEditor="false"))
+enum class EAuraFaction : uint8
+{
+	Player,
+	Enemy
+};
+
+constexpr int32 MakeFactionMask(EAuraFaction Faction) { return 1 << static_cast<int32>(Faction); }
+
 // This class does not need to be modified.
 UINTERFACE(MinimalAPI, BlueprintType)
 class UCombatInterface : public UInterface
@@ -109,4 +119,14 @@ public:
 
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable)
 	void SetIsBeingShocked(bool bInShock);
+
+	/** One bit per EAuraFaction. Plain virtual so friend/foe checks stay a cast and an AND. */
+	virtual int32 GetFactionMask() const { return 0; }
+
+	/** Faction mask of any object, 0 if it isn't a combatant */
+	static int32 GetFactionMaskOf(const UObject* Object)
+	{
+		const ICombatInterface* CombatInterface = Cast<ICombatInterface>(Object);
+		return CombatInterface ? CombatInterface->GetFactionMask() : 0;
+	}
 };
@@ -6,6 +6,8 @@
 #include "UObject/Interface.h"
 #include "PlayerInterface.generated.h"
 
+class ULevelUpInfo;
+
 UINTERFACE()
 class UPlayerInterface : public UInterface
 {
@@ -20,6 +22,9 @@ class AURA_API IPlayerInterface
 	GENERATED_BODY()
 
 public:
+
+	/** Progression table for native implementers, lets C++ callers skip the per-level reward events. Blueprint implementers leave it null. */
+	virtual const ULevelUpInfo* GetLevelUpInfo() const { return nullptr; }
 	
 	UFUNCTION(BlueprintNativeEvent)
 	int32 FindLevelForXP(int32 InXP) const;
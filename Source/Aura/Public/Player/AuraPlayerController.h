@@ -16,6 +16,9 @@ struct FInputActionValue;
 class IEnemyInterface;
 class UAuraAbilitySystemComponent;
 class USplineComponent;
+class UAuraCameraOcclusionComponent;
+class UAuraCursorHitComponent;
+class UAuraPathRequestComponent;
 
 /**
  * 
@@ -85,10 +88,20 @@ private:
 	UPROPERTY(VisibleAnywhere)
 	TObjectPtr<USplineComponent> Spline;
 
+	UPROPERTY(VisibleAnywhere)
+	TObjectPtr<UAuraCameraOcclusionComponent> CameraOcclusion;
+
+	UPROPERTY(VisibleAnywhere)
+	TObjectPtr<UAuraCursorHitComponent> CursorHits;
+
+	UPROPERTY(VisibleAnywhere)
+	TObjectPtr<UAuraPathRequestComponent> PathRequests;
+
 	UPROPERTY(EditDefaultsOnly)
 	TObjectPtr<UNiagaraSystem> ClickNiagaraSystem;
 
 	void AutoRun();
+	void FollowPath(const TArray<FVector>& PathPoints);
 
 	UPROPERTY(EditDefaultsOnly)
 	TSubclassOf<UDamageTextComponent> DamageTextComponentClass;
@@ -0,0 +1,63 @@
+// Copyright Axchemy Games
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AuraDamageNumberSubsystem.generated.h"
+
+/** One floating number, anchored where the hit landed */
+struct FAuraDamageNumber
+{
+	FVector Location = FVector::ZeroVector;
+	TWeakObjectPtr<const AActor> Target;
+	FString Text;
+	float Damage = 0.f;
+	float Age = 0.f;
+	uint64 Frame = 0;
+	uint32 Serial = 0;
+	bool bBlockedHit = false;
+	bool bCriticalHit = false;
+};
+
+/**
+ * Floating damage numbers for the local player, drawn in one pass by AAuraHUD instead of a widget component per hit.
+ * Numbers live in a fixed size buffer, oldest first. Hits on the same target in the same frame add up into one
+ * number, a full buffer drops its oldest number and every number ages out after Aura.DamageNumbers.Lifetime.
+ * Off by default (Aura.DamageNumbers.Batched): the canvas text doesn't carry the DamageTextComponent widget's styling
+ * or animation, so it is meant for heavy combat profiling rather than normal play.
+ */
+UCLASS()
+class AURA_API UAuraDamageNumberSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	static UAuraDamageNumberSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Queues a number over Target. False when batched numbers are turned off and the caller should fall back. */
+	bool Add(const AActor* Target, float Damage, bool bBlockedHit, bool bCriticalHit);
+
+	const TArray<FAuraDamageNumber>& GetNumbers() const { return Numbers; }
+	float GetLifetime() const;
+
+	/** UTickableWorldSubsystem */
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	/** end UTickableWorldSubsystem */
+
+	virtual void Deinitialize() override;
+
+protected:
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+
+	static void FormatText(FAuraDamageNumber& Number);
+
+	TArray<FAuraDamageNumber> Numbers;
+
+	uint32 NextSerial = 0;
+};
@@ -12,8 +12,47 @@ class UAttributeSet;
 class UAbilitySystemComponent;
 class UOverlayWidgetController;
 class UAuraUserWidget;
+class UFont;
 struct FWidgetControllerParams;
 
+/** How AAuraHUD draws the numbers queued in UAuraDamageNumberSubsystem */
+USTRUCT(BlueprintType)
+struct FAuraDamageNumberStyle
+{
+	GENERATED_BODY()
+
+	/** Falls back to the engine's large font */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	TObjectPtr<UFont> Font = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	FLinearColor Color = FLinearColor::White;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	FLinearColor CriticalHitColor = FLinearColor(1.f, 0.35f, 0.f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	FLinearColor BlockedHitColor = FLinearColor(0.5f, 0.5f, 0.5f);
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	float Scale = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	float CriticalHitScale = 1.5f;
+
+	/** Offset from the target's location to where a number starts */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	FVector AnchorOffset = FVector(0.f, 0.f, 80.f);
+
+	/** World units a number rises over its lifetime */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	float RiseDistance = 60.f;
+
+	/** Screen pixels consecutive numbers are spread apart so bursts don't stack */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	float HorizontalSpread = 20.f;
+};
+
 /**
  * 
  */
@@ -29,10 +68,17 @@ public:
 
 	void InitOverlay(APlayerController* PC, APlayerState* PS, UAbilitySystemComponent* ASC, UAttributeSet* AS);
 
+	virtual void DrawHUD() override;
+
 protected:
 	
 private:
 
+	void DrawDamageNumbers();
+
+	UPROPERTY(EditAnywhere, Category="Damage Numbers")
+	FAuraDamageNumberStyle DamageNumberStyle;
+
 	UPROPERTY()
 	TObjectPtr<UAuraUserWidget> OverlayWidget;
 
@@ -14,4 +14,8 @@ class AURA_API UDamageTextComponent : public UWidgetComponent
 public:
 	UFUNCTION(BlueprintImplementableEvent, BlueprintCallable)
 	void SetDamageText(float Damage, bool bBlockedHit, bool bCriticalHit);
+
+protected:
+	virtual void OnRegister() override;
+	virtual void OnUnregister() override;
 };